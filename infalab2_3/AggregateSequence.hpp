@@ -0,0 +1,238 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "Monoids.hpp"
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+// Последовательность с деревом отрезков по моноиду Monoid (см. Monoids.hpp).
+// Query(l, r) и Set — O(log n), Append — амортизированно O(log n)
+// (при удвоении ёмкости дерево перестраивается за O(n)). Вставка в середину
+// и Prepend сдвигают данные и перестраивают дерево — O(n).
+// Запись по ссылке через неконстантный operator[] запрещена: дерево бы
+// не узнало об изменении; для записи — Set.
+template<typename T, typename Monoid = SumMonoid<T>>
+class AggregateSequence : public Sequence<T> {
+public:
+    using Value = typename Monoid::Value;
+
+private:
+    using SeqUPtr = typename Sequence<T>::SeqUPtr;
+
+    DynamicArray<T> data_;
+    DynamicArray<Value> tree_;   // tree_[cap_ + i] — лист i, tree_[1] — корень
+    std::size_t cap_{0};
+
+    template<typename M, typename... Args>
+    SeqUPtr cloneInvoke(M method, Args&&... args) const {
+        auto cp = Clone();
+        (static_cast<AggregateSequence*>(cp.get())->*method)(std::forward<Args>(args)...);
+        return cp;
+    }
+
+    void checkIndex(std::size_t i, const char* where) const {
+        if (i >= data_.GetSize()) throw std::out_of_range(where);
+    }
+
+    // Перестроение снизу вверх за O(cap)
+    void rebuild() {
+        std::size_t n = data_.GetSize();
+        std::size_t cap = cap_ ? cap_ : 1;
+        while (cap < n) cap *= 2;
+        if (cap != cap_ || tree_.GetSize() != 2 * cap) {
+            cap_ = cap;
+            tree_ = DynamicArray<Value>(2 * cap_);
+        }
+        for (std::size_t i = 0; i < cap_; ++i)
+            tree_[cap_ + i] = i < n ? Monoid::Lift(data_[i]) : Monoid::Identity();
+        for (std::size_t i = cap_; i-- > 1; )
+            tree_[i] = Monoid::Combine(tree_[2 * i], tree_[2 * i + 1]);
+    }
+
+    // p указывает в data_ — такой аргумент пропадёт при Resize или затрётся сдвигом
+    bool aliases(const T* p) const {
+        const T* b = data_.Data();
+        std::less<const T*> lt;
+        return b && !lt(p, b) && lt(p, b + data_.GetSize());
+    }
+
+    // Дописывание src за один проход ForEach (по узлам у списков) и одно перестроение
+    void appendFrom(const Sequence<T>& src) {
+        DynamicArray<T> tail(src.GetLength());
+        std::size_t i = 0;
+        src.ForEach([&](const T& v) { tail[i++] = v; });
+        AppendRange(tail.Data(), tail.GetSize());
+    }
+
+    void updateLeaf(std::size_t i) {
+        std::size_t p = cap_ + i;
+        tree_[p] = Monoid::Lift(data_[i]);
+        for (p /= 2; p >= 1; p /= 2)
+            tree_[p] = Monoid::Combine(tree_[2 * p], tree_[2 * p + 1]);
+    }
+
+public:
+    // --- Конструкторы ---
+    AggregateSequence() = default;
+    AggregateSequence(const T* p, std::size_t n) : data_(p, n) {
+        rebuild();
+    }
+    explicit AggregateSequence(const Sequence<T>& src) : data_(src.GetLength()) {
+        std::size_t i = 0;
+        src.ForEach([&](const T& v) { data_[i++] = v; });
+        rebuild();
+    }
+
+    // --- Агрегаты ---
+
+    // Агрегат по [l..r] в порядке элементов
+    Value Query(std::size_t l, std::size_t r) const {
+        if (l > r || r >= data_.GetSize())
+            throw std::out_of_range("AggregateSequence::Query: bad range");
+        Value left = Monoid::Identity(), right = Monoid::Identity();
+        for (std::size_t lo = l + cap_, hi = r + cap_ + 1; lo < hi; lo /= 2, hi /= 2) {
+            if (lo & 1) left = Monoid::Combine(left, tree_[lo++]);
+            if (hi & 1) right = Monoid::Combine(tree_[--hi], right);
+        }
+        return Monoid::Combine(left, right);
+    }
+
+    // Агрегат всей последовательности — O(1)
+    Value Aggregate() const {
+        return cap_ ? tree_[1] : Monoid::Identity();
+    }
+
+    void Set(std::size_t i, const T& v) {
+        checkIndex(i, "AggregateSequence::Set: bad index");
+        data_[i] = v;
+        updateLeaf(i);
+    }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return data_.GetSize();
+    }
+    T Get(std::size_t i) const override {
+        checkIndex(i, "AggregateSequence::Get: bad index");
+        return data_[i];
+    }
+    T GetFirst() const override {
+        checkIndex(0, "AggregateSequence::GetFirst: empty");
+        return data_[0];
+    }
+    T GetLast() const override {
+        checkIndex(0, "AggregateSequence::GetLast: empty");
+        return data_[data_.GetSize() - 1];
+    }
+
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= data_.GetSize())
+            throw std::out_of_range("AggregateSequence::GetSubsequence: bad range");
+        return std::make_unique<AggregateSequence>(data_.Data() + l, r - l + 1);
+    }
+
+    // --- Клонирование ---
+    SeqUPtr Clone() const override {
+        return std::make_unique<AggregateSequence>(*this);
+    }
+    Sequence<T>* Instance() override {
+        return new AggregateSequence();
+    }
+
+    // --- Mutable API ---
+    void Append(const T& v) override {
+        if (aliases(&v)) {
+            T copy = v;
+            Append(copy);
+            return;
+        }
+        std::size_t n = data_.GetSize();
+        data_.Resize(n + 1);
+        data_[n] = v;
+        if (n + 1 > cap_) rebuild();
+        else updateLeaf(n);
+    }
+    void AppendRange(const T* items, std::size_t count) override {
+        if (count && aliases(items)) {
+            DynamicArray<T> copy(items, count);
+            AppendRange(copy.Data(), count);
+            return;
+        }
+        std::size_t n = data_.GetSize();
+        data_.Resize(n + count);
+        for (std::size_t i = 0; i < count; ++i) data_[n + i] = items[i];
+        rebuild();
+    }
+    void Prepend(const T& v) override {
+        InsertAt(v, 0);
+    }
+    void InsertAt(const T& v, std::size_t idx) override {
+        std::size_t n = data_.GetSize();
+        if (idx > n) throw std::out_of_range("AggregateSequence::InsertAt: bad idx");
+        if (aliases(&v)) {
+            T copy = v;
+            InsertAt(copy, idx);
+            return;
+        }
+        data_.Resize(n + 1);
+        for (std::size_t i = n; i > idx; --i) data_[i] = std::move(data_[i - 1]);
+        data_[idx] = v;
+        rebuild();
+    }
+    Sequence<T>* Concat(Sequence<T>* other) override {
+        appendFrom(*other);
+        return this;
+    }
+
+    // --- Immutable API ---
+    SeqUPtr Append(const T& v) const override {
+        return cloneInvoke(static_cast<void (AggregateSequence::*)(const T&)>(&AggregateSequence::Append), v);
+    }
+    SeqUPtr Prepend(const T& v) const override {
+        return cloneInvoke(static_cast<void (AggregateSequence::*)(const T&)>(&AggregateSequence::Prepend), v);
+    }
+    SeqUPtr InsertAt(const T& v, std::size_t idx) const override {
+        return cloneInvoke(static_cast<void (AggregateSequence::*)(const T&, std::size_t)>(&AggregateSequence::InsertAt), v, idx);
+    }
+    SeqUPtr Concat(const Sequence<T>* other) const override {
+        auto cp = Clone();
+        static_cast<AggregateSequence*>(cp.get())->appendFrom(*other);
+        return cp;
+    }
+
+    // --- Операторы доступа ---
+    T& operator[](std::size_t) override {
+        throw std::logic_error("AggregateSequence::operator[]: use Set");
+    }
+    const T& operator[](std::size_t i) const override {
+        checkIndex(i, "AggregateSequence::operator[] const: bad index");
+        return data_[i];
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, T& out) const override {
+        if (i >= data_.GetSize()) return false;
+        out = data_[i];
+        return true;
+    }
+    bool TryGetFirst(T& out) const override {
+        return TryGet(0, out);
+    }
+    bool TryGetLast(T& out) const override {
+        std::size_t n = data_.GetSize();
+        if (n == 0) return false;
+        return TryGet(n - 1, out);
+    }
+    bool TryFind(std::function<bool(const T&)> pred, T& out) const override {
+        for (std::size_t i = 0; i < data_.GetSize(); ++i) {
+            if (pred(data_[i])) {
+                out = data_[i];
+                return true;
+            }
+        }
+        return false;
+    }
+};
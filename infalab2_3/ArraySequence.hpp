@@ -2,14 +2,17 @@
 
 #include "Sequence.hpp"
 #include "DynamicArray.hpp"
+#include "CowArray.hpp"
 #include <stdexcept>
 #include <utility>
 #include <functional>
 
-template<typename T, typename Derived>
+// Storage — хранилище с интерфейсом DynamicArray (Get/Set/GetSize/Resize/operator[]).
+// По умолчанию CowArray: Clone за O(1), копия буфера — при первой записи.
+template<typename T, typename Derived, typename Storage = CowArray<T>>
 class ArraySequence : public Sequence<T> {
 protected:
-    DynamicArray<T> data_;  
+    Storage data_;  
 
     template<typename M, typename... Args>
     std::unique_ptr<Sequence<T>> cloneInvoke(M method, Args&&... args) const {
@@ -23,6 +26,16 @@ public:
     ArraySequence() = default;
     ArraySequence(const T* p, std::size_t n)
       : data_(p, n) {}
+    explicit ArraySequence(Storage storage)
+      : data_(std::move(storage)) {}
+
+    // --- Доступ к хранилищу ---
+    Storage& GetStorage() {
+        return data_;
+    }
+    const Storage& GetStorage() const {
+        return data_;
+    }
 
     // --- Методы чтения ---
     std::size_t GetLength() const override {
@@ -42,11 +55,7 @@ public:
     std::unique_ptr<Sequence<T>> GetSubsequence(std::size_t l, std::size_t r) const override {
         if (l > r || r >= GetLength())
             throw std::out_of_range("ArraySequence::GetSubsequence: bad range");
-        auto out = std::make_unique<Derived>();
-        for (std::size_t i = l; i <= r; ++i) {
-            out->Append(data_[i]);
-        }
-        return out;
+        return std::make_unique<Derived>(data_.Data() + l, r - l + 1);
     }
 
     // --- Клонирование ---
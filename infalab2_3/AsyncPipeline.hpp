@@ -0,0 +1,280 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DequeArraySequence.hpp"
+#include "DynamicArray.hpp"
+#include "Generator.hpp"
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+class EventLoop;
+
+// Задача конвейера: корутина, которую исполняет EventLoop. Создаётся
+// приостановленной, запускается через EventLoop::Spawn, по завершении
+// освобождается сама; не завершённые к уничтожению цикла уничтожает EventLoop.
+class PipelineTask {
+public:
+    struct promise_type {
+        EventLoop* loop{nullptr};
+        std::size_t slot{0};   // позиция в EventLoop::tasks_
+
+        PipelineTask get_return_object() {
+            return PipelineTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept;
+        void return_void() {}
+        void unhandled_exception();
+    };
+
+    PipelineTask(PipelineTask&& o) noexcept : h_(std::exchange(o.h_, nullptr)) {}
+    PipelineTask(const PipelineTask&) = delete;
+    PipelineTask& operator=(const PipelineTask&) = delete;
+    ~PipelineTask() {
+        if (h_) h_.destroy();  // так и не запущена
+    }
+
+private:
+    friend class EventLoop;
+    std::coroutine_handle<promise_type> h_;
+
+    explicit PipelineTask(std::coroutine_handle<promise_type> h) : h_(h) {}
+};
+
+// Однопоточный цикл событий: очередь готовых к продолжению корутин.
+// Run крутит её, пока есть готовые. Оставшиеся после Run задачи ждут очередь,
+// которую пополнят (или закроют) снаружи — иначе конвейер заблокирован.
+// Все запущенные и ещё не завершённые задачи учитываются в tasks_: деструктор
+// цикла уничтожает их кадры (ждущие незакрытой очереди или брошенные после
+// исключения в Run). Очереди цикла к этому моменту не должны ими пользоваться.
+class EventLoop {
+private:
+    using Handle = std::coroutine_handle<PipelineTask::promise_type>;
+
+    DequeArraySequence<std::coroutine_handle<>> ready_;
+    DynamicArray<Handle> tasks_;
+    std::exception_ptr error_;
+
+    friend struct PipelineTask::promise_type;
+
+    // Завершившаяся задача: на её место — последняя
+    void forget(std::size_t slot) {
+        std::size_t last = tasks_.GetSize() - 1;
+        if (slot != last) {
+            tasks_[slot] = tasks_[last];
+            tasks_[slot].promise().slot = slot;
+        }
+        tasks_.Resize(last);
+    }
+
+public:
+    EventLoop() = default;
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    ~EventLoop() {
+        for (std::size_t i = 0; i < tasks_.GetSize(); ++i)
+            tasks_[i].destroy();
+    }
+
+    void Spawn(PipelineTask task) {
+        Handle h = std::exchange(task.h_, nullptr);
+        h.promise().loop = this;
+        h.promise().slot = tasks_.GetSize();
+        tasks_.Resize(tasks_.GetSize() + 1);
+        tasks_[tasks_.GetSize() - 1] = h;
+        Post(h);
+    }
+
+    void Post(std::coroutine_handle<> h) {
+        ready_.Append(h);
+    }
+
+    std::size_t GetLiveTasks() const {
+        return tasks_.GetSize();
+    }
+
+    // Исполняет задачи до опустошения очереди; исключение задачи пробрасывается.
+    // true — все запущенные задачи завершились.
+    bool Run() {
+        while (ready_.GetLength() > 0) {
+            ready_.PopFront().resume();
+            if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+        return tasks_.GetSize() == 0;
+    }
+};
+
+inline std::suspend_never PipelineTask::promise_type::final_suspend() noexcept {
+    loop->forget(slot);
+    return {};
+}
+
+inline void PipelineTask::promise_type::unhandled_exception() {
+    loop->error_ = std::current_exception();
+}
+
+// Ограниченная очередь между стадиями конвейера. co_await Push ждёт при
+// заполнении, co_await Pop — при опустошении; ожидающие продолжаются через
+// EventLoop. Значение передаётся ожидающему напрямую, минуя буфер.
+template<typename T>
+class AsyncQueue {
+private:
+    struct PushAwaiter;
+    struct PopAwaiter;
+
+    EventLoop& loop_;
+    std::size_t capacity_;
+    DequeArraySequence<T> items_;
+    DequeArraySequence<PushAwaiter*> pushers_;
+    DequeArraySequence<PopAwaiter*> poppers_;
+    bool closed_{false};
+
+    struct PushAwaiter {
+        AsyncQueue& q;
+        T value;
+        std::coroutine_handle<> h{};
+        bool failed{false};
+
+        bool await_ready() {
+            if (q.closed_) {
+                failed = true;
+                return true;
+            }
+            if (q.poppers_.GetLength() > 0) {
+                PopAwaiter* p = q.poppers_.PopFront();
+                *p->out = std::move(value);
+                p->ok = true;
+                q.loop_.Post(p->h);
+                return true;
+            }
+            if (q.items_.GetLength() < q.capacity_) {
+                q.items_.Append(std::move(value));
+                return true;
+            }
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<> handle) {
+            h = handle;
+            q.pushers_.Append(this);
+        }
+        void await_resume() {
+            if (failed) throw std::logic_error("AsyncQueue::Push: queue closed");
+        }
+    };
+
+    struct PopAwaiter {
+        AsyncQueue& q;
+        T* out;
+        std::coroutine_handle<> h{};
+        bool ok{false};
+
+        bool await_ready() {
+            if (q.items_.GetLength() > 0) {
+                *out = q.items_.PopFront();
+                ok = true;
+                // освободилось место: значение первого ждущего производителя — в буфер
+                if (q.pushers_.GetLength() > 0) {
+                    PushAwaiter* p = q.pushers_.PopFront();
+                    q.items_.Append(std::move(p->value));
+                    q.loop_.Post(p->h);
+                }
+                return true;
+            }
+            if (q.pushers_.GetLength() > 0) {  // возможно при нулевой ёмкости
+                PushAwaiter* p = q.pushers_.PopFront();
+                *out = std::move(p->value);
+                ok = true;
+                q.loop_.Post(p->h);
+                return true;
+            }
+            return q.closed_;
+        }
+        void await_suspend(std::coroutine_handle<> handle) {
+            h = handle;
+            q.poppers_.Append(this);
+        }
+        bool await_resume() const {
+            return ok;
+        }
+    };
+
+public:
+    // capacity = 0 — рандеву: Push ждёт, пока значение не заберут
+    AsyncQueue(EventLoop& loop, std::size_t capacity)
+      : loop_(loop), capacity_(capacity) {}
+    AsyncQueue(const AsyncQueue&) = delete;
+    AsyncQueue& operator=(const AsyncQueue&) = delete;
+
+    std::size_t GetLength() const { return items_.GetLength(); }
+    std::size_t GetCapacity() const { return capacity_; }
+    bool IsClosed() const { return closed_; }
+
+    // co_await q.Push(v)
+    PushAwaiter Push(T v) {
+        return PushAwaiter{*this, std::move(v)};
+    }
+
+    // co_await q.Pop(out) -> false, если очередь закрыта и пуста
+    PopAwaiter Pop(T& out) {
+        return PopAwaiter{*this, &out};
+    }
+
+    // Ждущие потребители получают false, ждущие производители — исключение
+    void Close() {
+        closed_ = true;
+        while (poppers_.GetLength() > 0)
+            loop_.Post(poppers_.PopFront()->h);
+        while (pushers_.GetLength() > 0) {
+            PushAwaiter* p = pushers_.PopFront();
+            p->failed = true;
+            loop_.Post(p->h);
+        }
+    }
+};
+
+// --- Стадии конвейера ---
+
+// Источник: всё из генератора в очередь, затем Close
+template<typename T>
+PipelineTask ProduceStage(Generator<T> src, AsyncQueue<T>& out) {
+    for (const T& v : src)
+        co_await out.Push(v);
+    out.Close();
+}
+
+// Преобразование: f для каждого элемента, затем Close выходной очереди
+template<typename T, typename U, typename F>
+PipelineTask MapStage(AsyncQueue<T>& in, AsyncQueue<U>& out, F f) {
+    T v;
+    while (co_await in.Pop(v))
+        co_await out.Push(f(v));
+    out.Close();
+}
+
+template<typename T, typename Pred>
+PipelineTask WhereStage(AsyncQueue<T>& in, AsyncQueue<T>& out, Pred pred) {
+    T v;
+    while (co_await in.Pop(v))
+        if (pred(v)) co_await out.Push(v);
+    out.Close();
+}
+
+// Приёмник: дописывает всё в sink
+template<typename T>
+PipelineTask SinkStage(AsyncQueue<T>& in, Sequence<T>& sink) {
+    T v;
+    while (co_await in.Pop(v))
+        sink.Append(v);
+}
+
+// Приёмник-свёртка: acc = f(acc, v)
+template<typename T, typename U, typename F>
+PipelineTask ReduceStage(AsyncQueue<T>& in, U& acc, F f) {
+    T v;
+    while (co_await in.Pop(v))
+        acc = f(acc, v);
+}
@@ -0,0 +1,228 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "MutableArraySequence.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+// Последовательность флагов, упакованных по биту в 64-битные слова: в 8 раз
+// меньше памяти, чем MutableArraySequence<bool>. Count и Where идут по словам
+// (popcount / поиск младшего бита), а не по элементам.
+// Ссылки на отдельный бит нет: запись — через Set, неконстантный operator[] запрещён.
+class BitSequence : public Sequence<bool> {
+private:
+    using SeqUPtr = typename Sequence<bool>::SeqUPtr;
+    using Word = std::uint64_t;
+    static constexpr std::size_t kBits = 64;
+
+    static constexpr bool kTrue = true;
+    static constexpr bool kFalse = false;
+
+    DynamicArray<Word> words_;
+    std::size_t size_{0};
+
+    template<typename M, typename... Args>
+    SeqUPtr cloneInvoke(M method, Args&&... args) const {
+        auto cp = Clone();
+        (static_cast<BitSequence*>(cp.get())->*method)(std::forward<Args>(args)...);
+        return cp;
+    }
+
+    void checkIndex(std::size_t i, const char* where) const {
+        if (i >= size_) throw std::out_of_range(where);
+    }
+
+    bool bit(std::size_t i) const {
+        return (words_.Data()[i / kBits] >> (i % kBits)) & 1;
+    }
+
+    void assign(std::size_t i, bool v) {
+        Word mask = Word(1) << (i % kBits);
+        Word& w = words_.Data()[i / kBits];
+        w = v ? (w | mask) : (w & ~mask);
+    }
+
+    // Биты за концом последовательности держатся нулевыми: Count и Where на это полагаются
+    void clearTail() {
+        std::size_t r = size_ % kBits;
+        std::size_t used = (size_ + kBits - 1) / kBits;
+        if (r) words_.Data()[used - 1] &= (Word(1) << r) - 1;
+        for (std::size_t w = used; w < words_.GetSize(); ++w) words_.Data()[w] = 0;
+    }
+
+    void grow(std::size_t n) {
+        std::size_t need = (n + kBits - 1) / kBits;
+        if (need > words_.GetSize()) words_.Resize(need);  // новые слова нулевые
+        size_ = n;
+    }
+
+public:
+    // --- Конструкторы ---
+    BitSequence() = default;
+    BitSequence(const bool* p, std::size_t n) {
+        AppendRange(p, n);
+    }
+    // n флагов со значением v
+    BitSequence(std::size_t n, bool v) {
+        grow(n);
+        if (v) {
+            for (std::size_t w = 0; w < words_.GetSize(); ++w) words_.Data()[w] = ~Word(0);
+            clearTail();
+        }
+    }
+
+    // --- Побитовые запросы ---
+    void Set(std::size_t i, bool v) {
+        checkIndex(i, "BitSequence::Set: bad index");
+        assign(i, v);
+    }
+
+    // Число установленных флагов
+    std::size_t Count() const {
+        std::size_t used = (size_ + kBits - 1) / kBits, c = 0;
+        const Word* w = words_.Data();
+        for (std::size_t k = 0; k < used; ++k) c += std::popcount(w[k]);
+        return c;
+    }
+
+    // Позиции установленных флагов по возрастанию
+    MutableArraySequence<std::size_t> Where() const {
+        DynamicArray<std::size_t> out(Count());
+        std::size_t* dst = out.Data();
+        std::size_t used = (size_ + kBits - 1) / kBits;
+        const Word* w = words_.Data();
+        for (std::size_t k = 0; k < used; ++k) {
+            for (Word x = w[k]; x; x &= x - 1)
+                *dst++ = k * kBits + std::countr_zero(x);
+        }
+        return MutableArraySequence<std::size_t>(std::move(out));
+    }
+
+    std::size_t MemoryUsage() const {
+        return words_.GetCapacity() * sizeof(Word);
+    }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return size_;
+    }
+    bool Get(std::size_t i) const override {
+        checkIndex(i, "BitSequence::Get: bad index");
+        return bit(i);
+    }
+    bool GetFirst() const override {
+        checkIndex(0, "BitSequence::GetFirst: empty");
+        return bit(0);
+    }
+    bool GetLast() const override {
+        checkIndex(0, "BitSequence::GetLast: empty");
+        return bit(size_ - 1);
+    }
+
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= size_)
+            throw std::out_of_range("BitSequence::GetSubsequence: bad range");
+        auto out = std::make_unique<BitSequence>();
+        out->grow(r - l + 1);
+        for (std::size_t i = l; i <= r; ++i)
+            if (bit(i)) out->assign(i - l, true);
+        return out;
+    }
+
+    // --- Клонирование ---
+    SeqUPtr Clone() const override {
+        return std::make_unique<BitSequence>(*this);
+    }
+    Sequence<bool>* Instance() override {
+        return new BitSequence();
+    }
+
+    // --- Mutable API ---
+    void Append(const bool& v) override {
+        grow(size_ + 1);
+        assign(size_ - 1, v);
+    }
+    void AppendRange(const bool* items, std::size_t count) override {
+        std::size_t n = size_;
+        grow(n + count);
+        for (std::size_t i = 0; i < count; ++i)
+            assign(n + i, items[i]);
+    }
+    void Prepend(const bool& v) override {
+        InsertAt(v, 0);
+    }
+    // Сдвиг хвоста на один бит — по словам, O(n / 64)
+    void InsertAt(const bool& v, std::size_t idx) override {
+        if (idx > size_) throw std::out_of_range("BitSequence::InsertAt: bad idx");
+        grow(size_ + 1);
+        Word* w = words_.Data();
+        std::size_t first = idx / kBits, last = (size_ - 1) / kBits;
+        for (std::size_t k = last; k > first; --k)
+            w[k] = (w[k] << 1) | (w[k - 1] >> (kBits - 1));
+        std::size_t off = idx % kBits;
+        Word low = w[first] & ((Word(1) << off) - 1);
+        Word high = off + 1 < kBits ? (w[first] >> off) << (off + 1) : 0;
+        w[first] = low | high;
+        assign(idx, v);
+    }
+    Sequence<bool>* Concat(Sequence<bool>* other) override {
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            Append(other->Get(i));
+        return this;
+    }
+
+    // --- Immutable API ---
+    SeqUPtr Append(const bool& v) const override {
+        return cloneInvoke(static_cast<void (BitSequence::*)(const bool&)>(&BitSequence::Append), v);
+    }
+    SeqUPtr Prepend(const bool& v) const override {
+        return cloneInvoke(static_cast<void (BitSequence::*)(const bool&)>(&BitSequence::Prepend), v);
+    }
+    SeqUPtr InsertAt(const bool& v, std::size_t idx) const override {
+        return cloneInvoke(static_cast<void (BitSequence::*)(const bool&, std::size_t)>(&BitSequence::InsertAt), v, idx);
+    }
+    SeqUPtr Concat(const Sequence<bool>* other) const override {
+        auto cp = Clone();
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            static_cast<BitSequence*>(cp.get())->Append(other->Get(i));
+        return cp;
+    }
+
+    // --- Операторы доступа ---
+    bool& operator[](std::size_t) override {
+        throw std::logic_error("BitSequence::operator[]: use Set");
+    }
+    const bool& operator[](std::size_t i) const override {
+        checkIndex(i, "BitSequence::operator[] const: bad index");
+        return bit(i) ? kTrue : kFalse;
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, bool& out) const override {
+        if (i >= size_) return false;
+        out = bit(i);
+        return true;
+    }
+    bool TryGetFirst(bool& out) const override {
+        return TryGet(0, out);
+    }
+    bool TryGetLast(bool& out) const override {
+        if (size_ == 0) return false;
+        return TryGet(size_ - 1, out);
+    }
+    bool TryFind(std::function<bool(const bool&)> pred, bool& out) const override {
+        for (std::size_t i = 0; i < size_; ++i) {
+            bool v = bit(i);
+            if (pred(v)) {
+                out = v;
+                return true;
+            }
+        }
+        return false;
+    }
+};
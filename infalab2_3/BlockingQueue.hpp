@@ -0,0 +1,217 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Ограниченная блокирующая очередь для схем «производитель/потребитель».
+// Кольцевой буфер на DynamicArray фиксированной ёмкости: при заполнении
+// производитель ждёт (обратное давление), при опустошении ждёт потребитель.
+// Пакетные Enqueue/Dequeue переносят много элементов за один захват мьютекса.
+template<typename T>
+class BlockingQueue {
+private:
+    DynamicArray<T> ring_;
+    std::size_t head_{0};
+    std::size_t size_{0};
+    bool closed_{false};
+    mutable std::mutex m_;
+    std::condition_variable notEmpty_;
+    std::condition_variable notFull_;
+
+    // Вызываются под захваченным мьютексом
+    void push(const T& v) {
+        ring_[(head_ + size_) % ring_.GetSize()] = v;
+        ++size_;
+    }
+    T pop() {
+        T v = std::move(ring_[head_]);
+        head_ = (head_ + 1) % ring_.GetSize();
+        --size_;
+        return v;
+    }
+    // Отдаёт ресурсы скопированного наружу элемента (i-го от головы)
+    void release(std::size_t i) {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+            ring_[(head_ + i) % ring_.GetSize()] = T();
+    }
+    std::size_t popMany(T* out, std::size_t max) {
+        std::size_t n = size_ < max ? size_ : max;
+        for (std::size_t i = 0; i < n; ++i) out[i] = pop();
+        return n;
+    }
+
+public:
+    explicit BlockingQueue(std::size_t capacity)
+      : ring_(capacity)
+    {
+        if (capacity == 0) throw std::invalid_argument("BlockingQueue: zero capacity");
+    }
+
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+    // --- Состояние ---
+    std::size_t GetLength() const {
+        std::lock_guard<std::mutex> lk(m_);
+        return size_;
+    }
+    std::size_t GetCapacity() const {
+        return ring_.GetSize();
+    }
+    bool IsClosed() const {
+        std::lock_guard<std::mutex> lk(m_);
+        return closed_;
+    }
+
+    // Закрытие: новые Enqueue запрещены, ждущие потоки просыпаются,
+    // потребители дочитывают остаток и получают признак конца
+    void Close() {
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            closed_ = true;
+        }
+        notEmpty_.notify_all();
+        notFull_.notify_all();
+    }
+
+    // --- Enqueue ---
+    void Enqueue(const T& v) {
+        {
+            std::unique_lock<std::mutex> lk(m_);
+            notFull_.wait(lk, [&]{ return closed_ || size_ < ring_.GetSize(); });
+            if (closed_) throw std::logic_error("BlockingQueue::Enqueue: queue closed");
+            push(v);
+        }
+        notEmpty_.notify_one();
+    }
+
+    bool TryEnqueue(const T& v) {
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            if (closed_ || size_ == ring_.GetSize()) return false;
+            push(v);
+        }
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    template<typename Rep, typename Period>
+    bool EnqueueFor(const T& v, std::chrono::duration<Rep, Period> timeout) {
+        {
+            std::unique_lock<std::mutex> lk(m_);
+            if (!notFull_.wait_for(lk, timeout, [&]{ return closed_ || size_ < ring_.GetSize(); }))
+                return false;
+            if (closed_) return false;
+            push(v);
+        }
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    // Кладёт все n элементов, блокируясь по мере заполнения; за один захват
+    // переносится столько, сколько помещается. Возвращает число положенных
+    // (меньше n, только если очередь закрыли).
+    std::size_t EnqueueBatch(const T* items, std::size_t n) {
+        std::size_t done = 0;
+        while (done < n) {
+            {
+                std::unique_lock<std::mutex> lk(m_);
+                notFull_.wait(lk, [&]{ return closed_ || size_ < ring_.GetSize(); });
+                if (closed_) return done;
+                std::size_t room = ring_.GetSize() - size_;
+                std::size_t take = n - done < room ? n - done : room;
+                for (std::size_t i = 0; i < take; ++i) push(items[done + i]);
+                done += take;
+            }
+            notEmpty_.notify_all();
+        }
+        return done;
+    }
+
+    std::size_t EnqueueBatch(const Sequence<T>& items) {
+        std::size_t n = items.GetLength();
+        DynamicArray<T> buf(n);
+        std::size_t i = 0;
+        items.ForEach([&](const T& v) { buf[i++] = v; });   // один проход и для списков
+        return EnqueueBatch(buf.Data(), n);
+    }
+
+    // --- Dequeue ---
+    T Dequeue() {
+        T v;
+        {
+            std::unique_lock<std::mutex> lk(m_);
+            notEmpty_.wait(lk, [&]{ return closed_ || size_ > 0; });
+            if (size_ == 0) throw std::out_of_range("BlockingQueue::Dequeue: queue closed and empty");
+            v = pop();
+        }
+        notFull_.notify_one();
+        return v;
+    }
+
+    bool TryDequeue(T& out) {
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            if (size_ == 0) return false;
+            out = pop();
+        }
+        notFull_.notify_one();
+        return true;
+    }
+
+    template<typename Rep, typename Period>
+    bool DequeueFor(T& out, std::chrono::duration<Rep, Period> timeout) {
+        {
+            std::unique_lock<std::mutex> lk(m_);
+            if (!notEmpty_.wait_for(lk, timeout, [&]{ return closed_ || size_ > 0; }))
+                return false;
+            if (size_ == 0) return false;
+            out = pop();
+        }
+        notFull_.notify_one();
+        return true;
+    }
+
+    // Ждёт хотя бы один элемент и забирает до max за один захват.
+    // 0 означает, что очередь закрыта и пуста.
+    std::size_t DequeueBatch(T* out, std::size_t max) {
+        if (max == 0) return 0;
+        std::size_t n;
+        {
+            std::unique_lock<std::mutex> lk(m_);
+            notEmpty_.wait(lk, [&]{ return closed_ || size_ > 0; });
+            n = popMany(out, max);
+        }
+        if (n) notFull_.notify_all();
+        return n;
+    }
+
+    // Без промежуточного буфера: кольцо — не больше двух непрерывных кусков,
+    // каждый дописывается в out через AppendRange под тем же захватом.
+    // Если AppendRange бросит, очередь не изменится.
+    std::size_t DequeueBatch(Sequence<T>& out, std::size_t max) {
+        if (max == 0) return 0;
+        std::size_t n;
+        {
+            std::unique_lock<std::mutex> lk(m_);
+            notEmpty_.wait(lk, [&]{ return closed_ || size_ > 0; });
+            n = size_ < max ? size_ : max;
+            std::size_t cap = ring_.GetSize();
+            std::size_t first = cap - head_ < n ? cap - head_ : n;
+            out.AppendRange(ring_.Data() + head_, first);
+            out.AppendRange(ring_.Data(), n - first);
+            for (std::size_t i = 0; i < n; ++i) release(i);
+            head_ = (head_ + n) % cap;
+            size_ -= n;
+        }
+        if (n) notFull_.notify_all();
+        return n;
+    }
+};
@@ -0,0 +1,297 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Неизменяемая сжатая последовательность целых: блоки по kBlock значений,
+// внутри блока — разности соседних значений в zigzag-кодировке и varint
+// (1 байт на разность до ±63). Отсортированные ID и отметки времени сжимаются
+// в разы. Индекс пропуска хранит для каждого блока первое значение и смещение
+// в байтах, так что Get(i) декодирует не больше одного блока.
+// Последовательный обход (ForEach, Reader, Reduce, TryFind, DecodeInto) распаковывает блок
+// целиком в локальный буфер и идёт по нему; Map/Where/Reduce из algorithms.hpp
+// идут через ForEach. Цикл по индексам с Get здесь медленный: каждый вызов
+// заново декодирует начало блока (в среднем kBlock/2 разностей).
+// operator[] запрещён: значения в памяти нет, чтение — через Get.
+// Мутабельные методы запрещены; immutable-версии собирают новую последовательность.
+template<std::integral T>
+    requires (!std::same_as<T, bool>)
+class CompressedIntSequence : public Sequence<T> {
+public:
+    static constexpr std::size_t kBlock = 128;
+
+private:
+    using SeqUPtr = typename Sequence<T>::SeqUPtr;
+    using U = std::make_unsigned_t<T>;
+    using S = std::make_signed_t<T>;
+
+    struct BlockHeader {
+        T first{};
+        std::size_t offset{0};   // начало разностей блока в bytes_
+    };
+
+    DynamicArray<std::uint8_t> bytes_;
+    std::size_t used_{0};          // занято байт в bytes_
+    DynamicArray<BlockHeader> skip_;
+    std::size_t size_{0};
+    T last_{};                     // последнее значение — база для следующей разности
+
+    void checkIndex(std::size_t i, const char* where) const {
+        if (i >= size_) throw std::out_of_range(where);
+    }
+
+    static U zigzag(U delta) {
+        S s = static_cast<S>(delta);
+        return static_cast<U>(static_cast<U>(s) << 1) ^ static_cast<U>(s >> (std::numeric_limits<U>::digits - 1));
+    }
+    static U unzigzag(U z) {
+        return static_cast<U>((z >> 1) ^ static_cast<U>(-static_cast<U>(z & 1)));
+    }
+
+    void putByte(std::uint8_t b) {
+        if (used_ == bytes_.GetSize()) bytes_.Resize(used_ ? used_ * 2 : 64);
+        bytes_.Data()[used_++] = b;
+    }
+
+    // Дописывание в конец — единственный способ наполнения
+    void push(T v) {
+        if (size_ % kBlock == 0) {
+            std::size_t b = size_ / kBlock;
+            if (b == skip_.GetSize()) skip_.Resize(b ? b * 2 : 8);
+            skip_.Data()[b] = BlockHeader{v, used_};
+        } else {
+            U z = zigzag(static_cast<U>(static_cast<U>(v) - static_cast<U>(last_)));
+            while (z >= 0x80) {
+                putByte(static_cast<std::uint8_t>(z | 0x80));
+                z >>= 7;
+            }
+            putByte(static_cast<std::uint8_t>(z));
+        }
+        last_ = v;
+        ++size_;
+    }
+
+    std::size_t blockCount() const {
+        return (size_ + kBlock - 1) / kBlock;
+    }
+
+    // Распаковывает первые count значений блока b в out
+    void decodeBlock(std::size_t b, T* out, std::size_t count) const {
+        const BlockHeader& h = skip_.Data()[b];
+        const std::uint8_t* p = bytes_.Data() + h.offset;
+        U cur = static_cast<U>(h.first);
+        out[0] = h.first;
+        for (std::size_t i = 1; i < count; ++i) {
+            U z = 0;
+            int shift = 0;
+            std::uint8_t byte;
+            do {
+                byte = *p++;
+                z |= static_cast<U>(byte & 0x7F) << shift;
+                shift += 7;
+            } while (byte & 0x80);
+            cur = static_cast<U>(cur + unzigzag(z));
+            out[i] = static_cast<T>(cur);
+        }
+    }
+
+    std::size_t blockLength(std::size_t b) const {
+        return b + 1 < blockCount() ? kBlock : size_ - b * kBlock;
+    }
+
+    // f(const T* block, std::size_t n) -> bool: true — остановиться
+    template<typename F>
+    bool forEachBlock(F f) const {
+        T buf[kBlock];
+        for (std::size_t b = 0; b < blockCount(); ++b) {
+            std::size_t n = blockLength(b);
+            decodeBlock(b, buf, n);
+            if (f(static_cast<const T*>(buf), n)) return true;
+        }
+        return false;
+    }
+
+    [[noreturn]] static void immutable() {
+        throw std::logic_error("Immutable");
+    }
+
+public:
+    // --- Конструкторы ---
+    CompressedIntSequence() = default;
+    CompressedIntSequence(const T* p, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) push(p[i]);
+    }
+    explicit CompressedIntSequence(const Sequence<T>& src) {
+        src.ForEach([&](const T& v) { push(v); });
+    }
+
+    // --- Сжатие и блочный обход ---
+
+    // Байт на разности и индекс пропуска (без запаса ёмкости)
+    std::size_t MemoryUsage() const {
+        return used_ + blockCount() * sizeof(BlockHeader);
+    }
+
+    template<typename Acc, typename F>
+    Acc Reduce(Acc init, F f) const {
+        Acc acc = init;
+        forEachBlock([&](const T* block, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) acc = f(acc, block[i]);
+            return false;
+        });
+        return acc;
+    }
+
+    // Распаковка всей последовательности в dst (не меньше GetLength() элементов)
+    void DecodeInto(T* dst) const {
+        forEachBlock([&](const T* block, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) *dst++ = block[i];
+            return false;
+        });
+    }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return size_;
+    }
+    T Get(std::size_t i) const override {
+        checkIndex(i, "CompressedIntSequence::Get: bad index");
+        T buf[kBlock];
+        decodeBlock(i / kBlock, buf, i % kBlock + 1);
+        return buf[i % kBlock];
+    }
+    T GetFirst() const override {
+        checkIndex(0, "CompressedIntSequence::GetFirst: empty");
+        return skip_.Data()[0].first;
+    }
+    T GetLast() const override {
+        checkIndex(0, "CompressedIntSequence::GetLast: empty");
+        return last_;
+    }
+
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= size_)
+            throw std::out_of_range("CompressedIntSequence::GetSubsequence: bad range");
+        auto out = std::make_unique<CompressedIntSequence>();
+        T buf[kBlock];
+        for (std::size_t b = l / kBlock; b <= r / kBlock; ++b) {
+            std::size_t n = blockLength(b);
+            decodeBlock(b, buf, n);
+            for (std::size_t i = 0; i < n; ++i) {
+                std::size_t pos = b * kBlock + i;
+                if (pos >= l && pos <= r) out->push(buf[i]);
+            }
+        }
+        return out;
+    }
+
+    // --- Клонирование ---
+    SeqUPtr Clone() const override {
+        return std::make_unique<CompressedIntSequence>(*this);
+    }
+    Sequence<T>* Instance() override {
+        return new CompressedIntSequence();
+    }
+
+    // --- Mutable API: запрещён ---
+    void Append(const T&) override            { immutable(); }
+    void Prepend(const T&) override           { immutable(); }
+    void InsertAt(const T&, std::size_t) override { immutable(); }
+    Sequence<T>* Concat(Sequence<T>*) override { immutable(); }
+
+    // --- Immutable API ---
+    // Append дописывает в копию без перекодирования; остальное пересобирает за O(n)
+    SeqUPtr Append(const T& v) const override {
+        auto cp = std::make_unique<CompressedIntSequence>(*this);
+        cp->push(v);
+        return cp;
+    }
+    SeqUPtr Prepend(const T& v) const override {
+        return InsertAt(v, 0);
+    }
+    SeqUPtr InsertAt(const T& v, std::size_t idx) const override {
+        if (idx > size_) throw std::out_of_range("CompressedIntSequence::InsertAt: bad idx");
+        auto out = std::make_unique<CompressedIntSequence>();
+        std::size_t pos = 0;
+        forEachBlock([&](const T* block, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i, ++pos) {
+                if (pos == idx) out->push(v);
+                out->push(block[i]);
+            }
+            return false;
+        });
+        if (idx == size_) out->push(v);
+        return out;
+    }
+    SeqUPtr Concat(const Sequence<T>* other) const override {
+        auto cp = std::make_unique<CompressedIntSequence>(*this);
+        other->ForEach([&](const T& v) { cp->push(v); });
+        return cp;
+    }
+
+    // --- Операторы доступа ---
+    T& operator[](std::size_t) override {
+        throw std::logic_error("CompressedIntSequence::operator[]: immutable");
+    }
+    const T& operator[](std::size_t) const override {
+        throw std::logic_error("CompressedIntSequence::operator[] const: use Get");
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, T& out) const override {
+        if (i >= size_) return false;
+        out = Get(i);
+        return true;
+    }
+    bool TryGetFirst(T& out) const override {
+        return TryGet(0, out);
+    }
+    bool TryGetLast(T& out) const override {
+        if (size_ == 0) return false;
+        out = last_;
+        return true;
+    }
+    bool TryFind(std::function<bool(const T&)> pred, T& out) const override {
+        return forEachBlock([&](const T* block, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                if (pred(block[i])) {
+                    out = block[i];
+                    return true;
+                }
+            }
+            return false;
+        });
+    }
+    // Курсор держит распакованным текущий блок
+    std::function<bool(T&)> Reader() const override {
+        struct Cursor {
+            explicit Cursor(const CompressedIntSequence* s) : seq(s) {}
+            const CompressedIntSequence* seq;
+            std::size_t pos{0};
+            T buf[kBlock];
+            bool operator()(T& out) {
+                if (pos >= seq->size_) return false;
+                std::size_t i = pos % kBlock;
+                if (i == 0) seq->decodeBlock(pos / kBlock, buf, seq->blockLength(pos / kBlock));
+                out = buf[i];
+                ++pos;
+                return true;
+            }
+        };
+        return Cursor(this);
+    }
+    void ForEach(std::function<void(const T&)> f) const override {
+        forEachBlock([&](const T* block, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) f(block[i]);
+            return false;
+        });
+    }
+};
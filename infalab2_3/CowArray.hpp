@@ -0,0 +1,154 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+// Хранилище с копированием при записи поверх Storage (по умолчанию DynamicArray).
+// Копия CowArray разделяет буфер со счётчиком ссылок (атомарный, можно копировать
+// и читать из разных потоков) — O(1). Первая запись в разделяемый буфер
+// (Set, Resize, неконстантные operator[] и Data) делает собственную копию.
+// Ссылки и указатели, полученные неконстантным доступом, действительны до
+// следующего копирования этого CowArray.
+template<typename T, typename Storage = DynamicArray<T>>
+class CowArray {
+private:
+    struct Block {
+        std::atomic<std::size_t> refs{1};
+        Storage data;
+
+        explicit Block(Storage d) : data(std::move(d)) {}
+    };
+
+    Block* block_{nullptr};
+
+    void release() {
+        if (block_ && block_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete block_;
+        block_ = nullptr;
+    }
+
+    // Делает буфер собственным: копирует первые keep элементов в буфер размера size
+    void detach(std::size_t size, std::size_t keep) {
+        Storage fresh(size);
+        array_detail::copyRange(fresh.Data(), std::as_const(block_->data).Data(), keep);
+        Block* nb = new Block(std::move(fresh));
+        release();
+        block_ = nb;
+    }
+
+    // Пустое хранилище для CowArray без буфера: проверки индексов — политика Storage
+    const Storage& view() const {
+        static const Storage empty;
+        return block_ ? block_->data : empty;
+    }
+
+    Storage& own() {
+        if (!block_) {
+            block_ = new Block(Storage());
+        } else if (block_->refs.load(std::memory_order_acquire) != 1) {
+            std::size_t n = block_->data.GetSize();
+            detach(n, n);
+        }
+        return block_->data;
+    }
+
+public:
+    // --- Конструкторы и деструктор ---
+    CowArray() = default;
+
+    CowArray(Storage data)
+      : block_(new Block(std::move(data))) {}
+
+    CowArray(const T* items, std::size_t count)
+      : block_(new Block(Storage(items, count))) {}
+
+    CowArray(std::initializer_list<T> init)
+      : block_(new Block(Storage(init))) {}
+
+    explicit CowArray(std::size_t size)
+      : block_(new Block(Storage(size))) {}
+
+    CowArray(const CowArray& other)
+      : block_(other.block_)
+    {
+        if (block_) block_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    CowArray(CowArray&& o) noexcept
+      : block_(o.block_)
+    {
+        o.block_ = nullptr;
+    }
+
+    ~CowArray() {
+        release();
+    }
+
+    // --- Операторы присваивания ---
+    CowArray& operator=(const CowArray& other) {
+        if (block_ != other.block_) {
+            if (other.block_) other.block_->refs.fetch_add(1, std::memory_order_relaxed);
+            release();
+            block_ = other.block_;
+        }
+        return *this;
+    }
+
+    CowArray& operator=(CowArray&& o) noexcept {
+        if (this != &o) {
+            release();
+            block_ = o.block_;
+            o.block_ = nullptr;
+        }
+        return *this;
+    }
+
+    // --- Разделение ---
+    bool IsShared() const {
+        return block_ && block_->refs.load(std::memory_order_acquire) > 1;
+    }
+    std::size_t UseCount() const {
+        return block_ ? block_->refs.load(std::memory_order_acquire) : 0;
+    }
+
+    // --- Доступ к элементам ---
+    T Get(std::size_t idx) const {
+        return view().Get(idx);
+    }
+
+    void Set(std::size_t idx, const T& value) {
+        own().Set(idx, value);
+    }
+    void Set(std::size_t idx, T&& value) {
+        own().Set(idx, std::move(value));
+    }
+
+    T* Data()             { return block_ ? own().Data() : nullptr; }
+    const T* Data() const { return view().Data(); }
+
+    // --- Размер массива ---
+    std::size_t GetSize() const {
+        return view().GetSize();
+    }
+
+    // У разделяемого буфера копируется сразу в буфер нового размера
+    void Resize(std::size_t newSize) {
+        if (block_ && block_->refs.load(std::memory_order_acquire) != 1) {
+            std::size_t n = block_->data.GetSize();
+            detach(newSize, newSize < n ? newSize : n);
+            return;
+        }
+        own().Resize(newSize);
+    }
+
+    // --- Операторы индексации ---
+    T& operator[](std::size_t idx) {
+        return own()[idx];
+    }
+    const T& operator[](std::size_t idx) const {
+        return view()[idx];
+    }
+};
@@ -0,0 +1,231 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include <stdexcept>
+#include <utility>
+#include <functional>
+
+// Двусторонняя последовательность на «центрированном» буфере DynamicArray:
+// элементы лежат в [head_, head_ + size_), запас оставлен с обеих сторон.
+// Append/Prepend/PopFront/PopBack — амортизированно O(1), Get — O(1).
+template<typename T>
+class DequeArraySequence : public Sequence<T> {
+private:
+    DynamicArray<T> buf_;
+    std::size_t head_{0};
+    std::size_t size_{0};
+
+    using SeqUPtr = typename Sequence<T>::SeqUPtr;
+
+    template<typename M, typename... Args>
+    SeqUPtr cloneInvoke(M method, Args&&... args) const {
+        auto cp = Clone();
+        (static_cast<DequeArraySequence<T>*>(cp.get())->*method)(std::forward<Args>(args)...);
+        return cp;
+    }
+
+    // Освобождает место под extra элементов с обеих сторон: если буфер заполнен
+    // меньше чем наполовину — перецентрирует на месте, иначе удваивает ёмкость
+    void regrow(std::size_t extra) {
+        std::size_t cap = buf_.GetSize();
+        std::size_t need = size_ + extra;
+        if (need * 2 <= cap) {
+            std::size_t newHead = (cap - size_) / 2;
+            if (newHead < head_) {
+                for (std::size_t i = 0; i < size_; ++i)
+                    buf_[newHead + i] = std::move(buf_[head_ + i]);
+            } else {
+                for (std::size_t i = size_; i-- > 0; )
+                    buf_[newHead + i] = std::move(buf_[head_ + i]);
+            }
+            head_ = newHead;
+            return;
+        }
+        std::size_t newCap = cap ? cap * 2 : 8;
+        while (newCap < need * 2) newCap *= 2;
+        DynamicArray<T> nb(newCap);
+        std::size_t newHead = (newCap - size_) / 2;
+        for (std::size_t i = 0; i < size_; ++i)
+            nb[newHead + i] = std::move(buf_[head_ + i]);
+        buf_ = std::move(nb);
+        head_ = newHead;
+    }
+
+    void checkIndex(std::size_t i, const char* where) const {
+        if (i >= size_) throw std::out_of_range(where);
+    }
+
+    // p указывает в буфер — такой аргумент переедет или затрётся при regrow и сдвиге
+    bool aliases(const T* p) const {
+        const T* b = buf_.Data();
+        std::less<const T*> lt;
+        return b && !lt(p, b) && lt(p, b + buf_.GetSize());
+    }
+
+public:
+    // --- Конструкторы ---
+    DequeArraySequence() = default;
+    DequeArraySequence(const T* p, std::size_t n) {
+        AppendRange(p, n);
+    }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return size_;
+    }
+    T Get(std::size_t i) const override {
+        checkIndex(i, "DequeArraySequence::Get: bad index");
+        return buf_[head_ + i];
+    }
+    T GetFirst() const override {
+        checkIndex(0, "DequeArraySequence::GetFirst: empty");
+        return buf_[head_];
+    }
+    T GetLast() const override {
+        checkIndex(0, "DequeArraySequence::GetLast: empty");
+        return buf_[head_ + size_ - 1];
+    }
+
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= size_)
+            throw std::out_of_range("DequeArraySequence::GetSubsequence: bad range");
+        auto out = std::make_unique<DequeArraySequence<T>>();
+        out->regrow(r - l + 1);
+        for (std::size_t i = l; i <= r; ++i)
+            out->Append(buf_[head_ + i]);
+        return out;
+    }
+
+    // --- Клонирование ---
+    SeqUPtr Clone() const override {
+        return std::make_unique<DequeArraySequence<T>>(*this);
+    }
+    Sequence<T>* Instance() override {
+        return new DequeArraySequence<T>();
+    }
+
+    // --- Mutable API ---
+    void Append(const T& v) override {
+        if (aliases(&v)) {
+            T copy = v;
+            Append(copy);
+            return;
+        }
+        if (head_ + size_ == buf_.GetSize()) regrow(1);
+        buf_[head_ + size_] = v;
+        ++size_;
+    }
+    void Prepend(const T& v) override {
+        if (aliases(&v)) {
+            T copy = v;
+            Prepend(copy);
+            return;
+        }
+        if (head_ == 0) regrow(1);
+        buf_[--head_] = v;
+        ++size_;
+    }
+    void AppendRange(const T* items, std::size_t count) override {
+        if (count && aliases(items)) {
+            DynamicArray<T> copy(items, count);
+            AppendRange(copy.Data(), count);
+            return;
+        }
+        if (head_ + size_ + count > buf_.GetSize()) regrow(count);
+        for (std::size_t i = 0; i < count; ++i)
+            buf_[head_ + size_ + i] = items[i];
+        size_ += count;
+    }
+    // Сдвигается более короткая сторона
+    void InsertAt(const T& v, std::size_t idx) override {
+        if (idx > size_) throw std::out_of_range("DequeArraySequence::InsertAt: bad idx");
+        if (aliases(&v)) {
+            T copy = v;
+            InsertAt(copy, idx);
+            return;
+        }
+        if (idx < size_ / 2) {
+            if (head_ == 0) regrow(1);
+            --head_;
+            for (std::size_t i = 0; i < idx; ++i)
+                buf_[head_ + i] = std::move(buf_[head_ + i + 1]);
+        } else {
+            if (head_ + size_ == buf_.GetSize()) regrow(1);
+            for (std::size_t i = size_; i > idx; --i)
+                buf_[head_ + i] = std::move(buf_[head_ + i - 1]);
+        }
+        buf_[head_ + idx] = v;
+        ++size_;
+    }
+    Sequence<T>* Concat(Sequence<T>* other) override {
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            Append(other->Get(i));
+        return this;
+    }
+
+    // --- Снятие с концов ---
+    T PopFront() {
+        checkIndex(0, "DequeArraySequence::PopFront: empty");
+        T v = std::move(buf_[head_]);
+        ++head_;
+        if (--size_ == 0) head_ = buf_.GetSize() / 2;
+        return v;
+    }
+    T PopBack() {
+        checkIndex(0, "DequeArraySequence::PopBack: empty");
+        T v = std::move(buf_[head_ + size_ - 1]);
+        if (--size_ == 0) head_ = buf_.GetSize() / 2;
+        return v;
+    }
+
+    // --- Immutable API ---
+    SeqUPtr Append(const T& v) const override {
+        return cloneInvoke(static_cast<void (DequeArraySequence::*)(const T&)>(&DequeArraySequence::Append), v);
+    }
+    SeqUPtr Prepend(const T& v) const override {
+        return cloneInvoke(static_cast<void (DequeArraySequence::*)(const T&)>(&DequeArraySequence::Prepend), v);
+    }
+    SeqUPtr InsertAt(const T& v, std::size_t idx) const override {
+        return cloneInvoke(static_cast<void (DequeArraySequence::*)(const T&, std::size_t)>(&DequeArraySequence::InsertAt), v, idx);
+    }
+    SeqUPtr Concat(const Sequence<T>* other) const override {
+        auto cp = Clone();
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            static_cast<DequeArraySequence<T>*>(cp.get())->Append(other->Get(i));
+        return cp;
+    }
+
+    // --- Операторы доступа ---
+    T& operator[](std::size_t i) override {
+        checkIndex(i, "DequeArraySequence::operator[]: bad index");
+        return buf_[head_ + i];
+    }
+    const T& operator[](std::size_t i) const override {
+        checkIndex(i, "DequeArraySequence::operator[] const: bad index");
+        return buf_[head_ + i];
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, T& out) const override {
+        if (i >= size_) return false;
+        out = buf_[head_ + i];
+        return true;
+    }
+    bool TryGetFirst(T& out) const override {
+        return TryGet(0, out);
+    }
+    bool TryGetLast(T& out) const override {
+        if (size_ == 0) return false;
+        return TryGet(size_ - 1, out);
+    }
+    bool TryFind(std::function<bool(const T&)> pred, T& out) const override {
+        for (std::size_t i = 0; i < size_; ++i) {
+            if (pred(buf_[head_ + i])) {
+                out = buf_[head_ + i];
+                return true;
+            }
+        }
+        return false;
+    }
+};
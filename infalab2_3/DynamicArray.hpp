@@ -1,123 +1,319 @@
 #pragma once
 
-#include <cstddef>    
-#include <stdexcept>  
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
 #include <initializer_list>
-#include <utility>    
+#include <utility>
+#include <new>
+#include <memory>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#endif
+
+// --- Политики роста ёмкости: Grow(текущая, нужная) -> новая ёмкость ---
+
+// Ёмкость ровно под размер (поведение без запаса)
+struct ExactGrowth {
+    static std::size_t Grow(std::size_t, std::size_t needed) {
+        return needed;
+    }
+};
+
+// Геометрический рост в Num/Den раз: амортизированно O(1) на Resize(n + 1)
+template<std::size_t Num, std::size_t Den = 1>
+struct GeometricGrowth {
+    static_assert(Num > Den, "GeometricGrowth: factor must be greater than 1");
+    static std::size_t Grow(std::size_t capacity, std::size_t needed) {
+        std::size_t next = capacity / Den * Num;
+        if (next < 8) next = 8;
+        return next < needed ? needed : next;
+    }
+};
+
+using DoublingGrowth = GeometricGrowth<2>;
+
+// --- Политики проверки индексов ---
+
+struct CheckedBounds {
+    static void Check(std::size_t idx, std::size_t size, const char* where) {
+        if (idx >= size) throw std::out_of_range(where);
+    }
+};
+
+// Без проверок: для горячих циклов, где индексы уже гарантированы
+struct UncheckedBounds {
+    static void Check(std::size_t, std::size_t, const char*) {}
+};
+
+// --- Политики выделения памяти: Allocate<T>(n) / Deallocate<T>(p, n), память сырая ---
+
+struct NewAllocator {
+    template<typename T>
+    static T* Allocate(std::size_t n) {
+        if (n == 0) return nullptr;
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    }
+    template<typename T>
+    static void Deallocate(T* p, std::size_t) {
+        ::operator delete(p, std::align_val_t(alignof(T)));
+    }
+};
+
+// Выравнивание буфера по Align байт (например, 64 — кеш-линия, 32/64 — под SIMD)
+template<std::size_t Align>
+struct AlignedAllocator {
+    static_assert((Align & (Align - 1)) == 0, "AlignedAllocator: alignment must be a power of two");
+
+    template<typename T>
+    static constexpr std::size_t alignment() {
+        return Align > alignof(T) ? Align : alignof(T);
+    }
+    template<typename T>
+    static T* Allocate(std::size_t n) {
+        if (n == 0) return nullptr;
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignment<T>())));
+    }
+    template<typename T>
+    static void Deallocate(T* p, std::size_t) {
+        ::operator delete(p, std::align_val_t(alignment<T>()));
+    }
+};
+
+// Большие буферы выравниваются по 2 МиБ и помечаются для прозрачных huge pages
+// (там, где есть MADV_HUGEPAGE); меньшие выделяются как в AlignedAllocator<64>
+struct HugePageAllocator {
+    static constexpr std::size_t kHugePage = std::size_t(1) << 21;
+
+    template<typename T>
+    static std::size_t alignment(std::size_t n) {
+        return n * sizeof(T) >= kHugePage ? kHugePage : (alignof(T) > 64 ? alignof(T) : 64);
+    }
+    template<typename T>
+    static T* Allocate(std::size_t n) {
+        if (n == 0) return nullptr;
+        std::size_t align = alignment<T>(n);
+        void* p = ::operator new(n * sizeof(T), std::align_val_t(align));
+#ifdef MADV_HUGEPAGE
+        if (align == kHugePage) madvise(p, n * sizeof(T), MADV_HUGEPAGE);
+#endif
+        return static_cast<T*>(p);
+    }
+    template<typename T>
+    static void Deallocate(T* p, std::size_t n) {
+        ::operator delete(p, std::align_val_t(alignment<T>(n)));
+    }
+};
+
+// --- Копирование и сдвиг диапазонов уже сконструированных элементов ---
+// Для тривиально копируемых T — memcpy/memmove, иначе поэлементное присваивание
+
+namespace array_detail {
 
 template<typename T>
+void copyRange(T* dst, const T* src, std::size_t n) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (n) std::memcpy(dst, src, n * sizeof(T));
+    } else {
+        std::copy_n(src, n, dst);
+    }
+}
+
+// [p, p + n) -> [p + 1, p + n + 1); элемент p[n] должен быть сконструирован
+template<typename T>
+void shiftRight(T* p, std::size_t n) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (n) std::memmove(p + 1, p, n * sizeof(T));
+    } else {
+        std::move_backward(p, p + n, p + n + 1);
+    }
+}
+
+}  // namespace array_detail
+
+// Динамический массив с политиками роста (Growth), проверки индексов (Bounds)
+// и выделения памяти (Alloc). Элементы [0, size_) сконструированы,
+// [size_, capacity_) — сырая память под будущий рост.
+template<typename T,
+         typename Growth = DoublingGrowth,
+         typename Bounds = CheckedBounds,
+         typename Alloc = NewAllocator>
 class DynamicArray {
 private:
-    T* data_;              
-    std::size_t size_;    
+    T* data_;
+    std::size_t size_;
+    std::size_t capacity_;
+
+    static T* allocate(std::size_t n) {
+        return Alloc::template Allocate<T>(n);
+    }
+    void destroyAndFree() {
+        std::destroy_n(data_, size_);
+        if (data_) Alloc::template Deallocate<T>(data_, capacity_);
+    }
+
+    static constexpr bool kTrivial = std::is_trivially_copyable_v<T>;
+
+    // Переезд в буфер ёмкостью cap (cap >= size_); тривиальные T — одним memcpy
+    void reallocate(std::size_t cap) {
+        T* fresh = allocate(cap);
+        if constexpr (kTrivial) {
+            if (size_) std::memcpy(static_cast<void*>(fresh), data_, size_ * sizeof(T));
+            if (data_) Alloc::template Deallocate<T>(data_, capacity_);
+            data_ = fresh;
+            capacity_ = cap;
+            return;
+        }
+        std::size_t moved = 0;
+        try {
+            for (; moved < size_; ++moved)
+                ::new (static_cast<void*>(fresh + moved)) T(std::move_if_noexcept(data_[moved]));
+        } catch (...) {
+            std::destroy_n(fresh, moved);
+            if (fresh) Alloc::template Deallocate<T>(fresh, cap);
+            throw;
+        }
+        destroyAndFree();
+        data_ = fresh;
+        capacity_ = cap;
+    }
+
+    // Копия count элементов: тривиальные T — одним memcpy
+    void initCopy(const T* items, std::size_t count) {
+        if constexpr (kTrivial) {
+            data_ = allocate(count);
+            capacity_ = size_ = count;
+            if (count) std::memcpy(static_cast<void*>(data_), items, count * sizeof(T));
+        } else {
+            init(count, [&](T* p, std::size_t i) { ::new (static_cast<void*>(p)) T(items[i]); });
+        }
+    }
+
+    template<typename Fill>
+    void init(std::size_t count, Fill fill) {
+        data_ = allocate(count);
+        capacity_ = count;
+        size_ = 0;
+        try {
+            for (; size_ < count; ++size_)
+                fill(data_ + size_, size_);
+        } catch (...) {
+            destroyAndFree();
+            throw;
+        }
+    }
+
 public:
     // --- Конструкторы и деструктор ---
-    DynamicArray() : data_(nullptr), size_(0) {}
+    DynamicArray() : data_(nullptr), size_(0), capacity_(0) {}
 
-    DynamicArray(const T* items, std::size_t count)
-      : data_(new T[count]), size_(count)
-    {
-        for (std::size_t i = 0; i < size_; ++i)
-            data_[i] = items[i];
+    DynamicArray(const T* items, std::size_t count) {
+        initCopy(items, count);
     }
 
-    DynamicArray(std::initializer_list<T> init)
-      : data_(new T[init.size()]), size_(init.size())
-    {
-        std::size_t i = 0;
-        for (const T& v : init)
-            data_[i++] = v;
+    DynamicArray(std::initializer_list<T> init_) {
+        initCopy(init_.begin(), init_.size());
     }
 
-    explicit DynamicArray(std::size_t size)
-      : data_(new T[size]), size_(size)
-    {
-        for (std::size_t i = 0; i < size_; ++i)
-            data_[i] = T();
+    explicit DynamicArray(std::size_t size) {
+        init(size, [](T* p, std::size_t) { ::new (static_cast<void*>(p)) T(); });
     }
 
     // Конструктор копирования
-    DynamicArray(const DynamicArray& other)
-      : data_(new T[other.size_]), size_(other.size_)
-    {
-        for (std::size_t i = 0; i < size_; ++i)
-            data_[i] = other.data_[i];
+    DynamicArray(const DynamicArray& other) {
+        initCopy(other.data_, other.size_);
     }
 
     // Конструктор перемещения
     DynamicArray(DynamicArray&& o) noexcept
-      : data_(o.data_), size_(o.size_)
+      : data_(o.data_), size_(o.size_), capacity_(o.capacity_)
     {
         o.data_ = nullptr;
         o.size_ = 0;
+        o.capacity_ = 0;
     }
 
     ~DynamicArray() {
-        delete[] data_;
+        destroyAndFree();
     }
 
     // --- Операторы присваивания ---
     DynamicArray& operator=(const DynamicArray& other) {
         if (this != &other) {
-            delete[] data_;
-            size_ = other.size_;
-            data_ = new T[size_];
-            for (std::size_t i = 0; i < size_; ++i)
-                data_[i] = other.data_[i];
+            DynamicArray tmp(other);
+            *this = std::move(tmp);
         }
         return *this;
     }
 
     DynamicArray& operator=(DynamicArray&& o) noexcept {
         if (this != &o) {
-            delete[] data_;
+            destroyAndFree();
             data_ = o.data_;
             size_ = o.size_;
+            capacity_ = o.capacity_;
             o.data_ = nullptr;
             o.size_ = 0;
+            o.capacity_ = 0;
         }
         return *this;
     }
 
     // --- Доступ к элементам ---
     T Get(std::size_t idx) const {
-        if (idx >= size_) throw std::out_of_range("DynamicArray::Get: bad index");
+        Bounds::Check(idx, size_, "DynamicArray::Get: bad index");
         return data_[idx];
     }
 
     void Set(std::size_t idx, const T& value) {
-        if (idx >= size_) throw std::out_of_range("DynamicArray::Set: bad index");
+        Bounds::Check(idx, size_, "DynamicArray::Set: bad index");
         data_[idx] = value;
     }
     void Set(std::size_t idx, T&& value) {
-        if (idx >= size_) throw std::out_of_range("DynamicArray::Set: bad index");
+        Bounds::Check(idx, size_, "DynamicArray::Set: bad index");
         data_[idx] = std::move(value);
     }
 
+    T* Data()             { return data_; }
+    const T* Data() const { return data_; }
+
     // --- Размер массива ---
     std::size_t GetSize() const {
         return size_;
     }
+    std::size_t GetCapacity() const {
+        return capacity_;
+    }
+
+    void Reserve(std::size_t n) {
+        if (n > capacity_) reallocate(n);
+    }
 
+    // Новые элементы инициализируются T(); ёмкость растёт по политике Growth
     void Resize(std::size_t newSize) {
-        T* newData = new T[newSize];
-        std::size_t n = (newSize < size_ ? newSize : size_);
-        for (std::size_t i = 0; i < n; ++i)
-            newData[i] = std::move(data_[i]);
-        for (std::size_t i = n; i < newSize; ++i)
-            newData[i] = T();
-        delete[] data_;
-        data_ = newData;
-        size_ = newSize;
+        if (newSize > capacity_)
+            reallocate(Growth::Grow(capacity_, newSize));
+        if (newSize < size_) {
+            std::destroy(data_ + newSize, data_ + size_);
+            size_ = newSize;
+        }
+        for (; size_ < newSize; ++size_)
+            ::new (static_cast<void*>(data_ + size_)) T();
+    }
+
+    void ShrinkToFit() {
+        if (capacity_ > size_) reallocate(size_);
     }
 
     // --- Операторы индексации ---
     T& operator[](std::size_t idx) {
-        if (idx >= size_) throw std::out_of_range("DynamicArray::operator[]: bad index");
+        Bounds::Check(idx, size_, "DynamicArray::operator[]: bad index");
         return data_[idx];
     }
     const T& operator[](std::size_t idx) const {
-        if (idx >= size_) throw std::out_of_range("DynamicArray::operator[] const: bad index");
+        Bounds::Check(idx, size_, "DynamicArray::operator[] const: bad index");
         return data_[idx];
     }
 };
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <functional>
+
+// Последовательность фиксированной ёмкости N со встроенным хранилищем:
+// без кучи и без виртуальных вызовов, все методы constexpr.
+// Get/GetFirst/GetLast проверяют индекс, operator[] — нет (как у std::array).
+// Там, где нужен Sequence<T>&, используется AsSequence(seq).
+template<typename T, std::size_t N>
+class FixedArraySequence {
+private:
+    T items_[N > 0 ? N : 1]{};
+    std::size_t size_{0};
+
+public:
+    using value_type = T;
+
+    // --- Конструкторы ---
+    constexpr FixedArraySequence() = default;
+
+    constexpr FixedArraySequence(std::initializer_list<T> init) {
+        if (init.size() > N) throw std::length_error("FixedArraySequence: capacity exceeded");
+        for (const T& v : init) items_[size_++] = v;
+    }
+
+    constexpr FixedArraySequence(const T* p, std::size_t n) {
+        if (n > N) throw std::length_error("FixedArraySequence: capacity exceeded");
+        for (std::size_t i = 0; i < n; ++i) items_[i] = p[i];
+        size_ = n;
+    }
+
+    // --- Методы чтения ---
+    static constexpr std::size_t Capacity() { return N; }
+    constexpr std::size_t GetLength() const { return size_; }
+    constexpr bool IsFull() const { return size_ == N; }
+
+    constexpr const T& Get(std::size_t i) const {
+        if (i >= size_) throw std::out_of_range("FixedArraySequence::Get: bad index");
+        return items_[i];
+    }
+    constexpr const T& GetFirst() const {
+        if (size_ == 0) throw std::out_of_range("FixedArraySequence::GetFirst: empty");
+        return items_[0];
+    }
+    constexpr const T& GetLast() const {
+        if (size_ == 0) throw std::out_of_range("FixedArraySequence::GetLast: empty");
+        return items_[size_ - 1];
+    }
+
+    // Подпоследовательность [l..r]
+    constexpr FixedArraySequence GetSubsequence(std::size_t l, std::size_t r) const {
+        if (l > r || r >= size_)
+            throw std::out_of_range("FixedArraySequence::GetSubsequence: bad range");
+        return FixedArraySequence(items_ + l, r - l + 1);
+    }
+
+    // --- Модификаторы ---
+    constexpr void Append(const T& v) {
+        if (size_ == N) throw std::length_error("FixedArraySequence::Append: capacity exceeded");
+        items_[size_++] = v;
+    }
+    constexpr void Prepend(const T& v) {
+        InsertAt(v, 0);
+    }
+    constexpr void InsertAt(const T& v, std::size_t idx) {
+        if (idx > size_) throw std::out_of_range("FixedArraySequence::InsertAt: bad idx");
+        if (size_ == N) throw std::length_error("FixedArraySequence::InsertAt: capacity exceeded");
+        for (std::size_t i = size_; i > idx; --i) items_[i] = std::move(items_[i - 1]);
+        items_[idx] = v;
+        ++size_;
+    }
+    template<std::size_t M>
+    constexpr FixedArraySequence& Concat(const FixedArraySequence<T, M>& other) {
+        for (std::size_t i = 0; i < other.GetLength(); ++i) Append(other[i]);
+        return *this;
+    }
+    constexpr void Clear() {
+        size_ = 0;
+    }
+
+    // --- Доступ без проверок ---
+    constexpr T& operator[](std::size_t i) { return items_[i]; }
+    constexpr const T& operator[](std::size_t i) const { return items_[i]; }
+    constexpr T* Data() { return items_; }
+    constexpr const T* Data() const { return items_; }
+    constexpr T* begin() { return items_; }
+    constexpr T* end() { return items_ + size_; }
+    constexpr const T* begin() const { return items_; }
+    constexpr const T* end() const { return items_ + size_; }
+
+    // --- Try-версии ---
+    constexpr bool TryGet(std::size_t i, T& out) const {
+        if (i >= size_) return false;
+        out = items_[i];
+        return true;
+    }
+    constexpr bool TryGetFirst(T& out) const {
+        return TryGet(0, out);
+    }
+    constexpr bool TryGetLast(T& out) const {
+        if (size_ == 0) return false;
+        return TryGet(size_ - 1, out);
+    }
+    template<typename Pred>
+    constexpr bool TryFind(Pred pred, T& out) const {
+        for (std::size_t i = 0; i < size_; ++i) {
+            if (pred(items_[i])) {
+                out = items_[i];
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// Адаптер к Sequence<T>: ссылается на внешний FixedArraySequence либо владеет копией
+// (копии, Clone, GetSubsequence и Instance владеют своими данными).
+template<typename T, std::size_t N>
+class FixedArraySequenceAdapter : public Sequence<T> {
+private:
+    FixedArraySequence<T, N> own_;
+    FixedArraySequence<T, N>* ref_;
+
+    using SeqUPtr = typename Sequence<T>::SeqUPtr;
+    using Self = FixedArraySequenceAdapter<T, N>;
+
+    SeqUPtr owning(const FixedArraySequence<T, N>& v) const {
+        auto out = std::make_unique<Self>();
+        out->own_ = v;
+        return out;
+    }
+
+public:
+    FixedArraySequenceAdapter() : ref_(&own_) {}
+    explicit FixedArraySequenceAdapter(FixedArraySequence<T, N>& seq) : ref_(&seq) {}
+    FixedArraySequenceAdapter(const FixedArraySequenceAdapter& o) : own_(*o.ref_), ref_(&own_) {}
+    FixedArraySequenceAdapter& operator=(const FixedArraySequenceAdapter&) = delete;
+
+    FixedArraySequence<T, N>& GetFixed() { return *ref_; }
+    const FixedArraySequence<T, N>& GetFixed() const { return *ref_; }
+
+    std::size_t GetLength() const override { return ref_->GetLength(); }
+    T Get(std::size_t i) const override { return ref_->Get(i); }
+    T GetFirst() const override { return ref_->GetFirst(); }
+    T GetLast() const override { return ref_->GetLast(); }
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        return owning(ref_->GetSubsequence(l, r));
+    }
+
+    SeqUPtr Clone() const override { return std::make_unique<Self>(*this); }
+    Sequence<T>* Instance() override { return new Self(); }
+
+    void Append(const T& v) override { ref_->Append(v); }
+    void Prepend(const T& v) override { ref_->Prepend(v); }
+    void InsertAt(const T& v, std::size_t idx) override { ref_->InsertAt(v, idx); }
+    Sequence<T>* Concat(Sequence<T>* other) override {
+        for (std::size_t i = 0; i < other->GetLength(); ++i) ref_->Append(other->Get(i));
+        return this;
+    }
+
+    SeqUPtr Append(const T& v) const override {
+        auto cp = *ref_;
+        cp.Append(v);
+        return owning(cp);
+    }
+    SeqUPtr Prepend(const T& v) const override {
+        auto cp = *ref_;
+        cp.Prepend(v);
+        return owning(cp);
+    }
+    SeqUPtr InsertAt(const T& v, std::size_t idx) const override {
+        auto cp = *ref_;
+        cp.InsertAt(v, idx);
+        return owning(cp);
+    }
+    SeqUPtr Concat(const Sequence<T>* other) const override {
+        auto cp = *ref_;
+        for (std::size_t i = 0; i < other->GetLength(); ++i) cp.Append(other->Get(i));
+        return owning(cp);
+    }
+
+    T& operator[](std::size_t i) override {
+        if (i >= ref_->GetLength()) throw std::out_of_range("FixedArraySequenceAdapter::operator[]: bad index");
+        return (*ref_)[i];
+    }
+    const T& operator[](std::size_t i) const override {
+        return ref_->Get(i);
+    }
+
+    bool TryGet(std::size_t i, T& out) const override { return ref_->TryGet(i, out); }
+    bool TryGetFirst(T& out) const override { return ref_->TryGetFirst(out); }
+    bool TryGetLast(T& out) const override { return ref_->TryGetLast(out); }
+    bool TryFind(std::function<bool(const T&)> pred, T& out) const override {
+        return ref_->TryFind(pred, out);
+    }
+};
+
+template<typename T, std::size_t N>
+FixedArraySequenceAdapter<T, N> AsSequence(FixedArraySequence<T, N>& seq) {
+    return FixedArraySequenceAdapter<T, N>(seq);
+}
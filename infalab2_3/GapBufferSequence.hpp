@@ -0,0 +1,239 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include <stdexcept>
+#include <utility>
+#include <functional>
+
+// Последовательность на буфере с разрывом (gap buffer): свободное место
+// [gapStart_, gapEnd_) держится в позиции курсора. Вставка и удаление у курсора —
+// амортизированно O(1), перенос курсора — O(расстояния). Подходит для правок,
+// которые ложатся рядом друг с другом (редактор, последовательные InsertAt).
+template<typename T>
+class GapBufferSequence : public Sequence<T> {
+private:
+    DynamicArray<T> buf_;
+    std::size_t gapStart_{0};
+    std::size_t gapEnd_{0};
+
+    using SeqUPtr = typename Sequence<T>::SeqUPtr;
+
+    template<typename M, typename... Args>
+    SeqUPtr cloneInvoke(M method, Args&&... args) const {
+        auto cp = Clone();
+        (static_cast<GapBufferSequence<T>*>(cp.get())->*method)(std::forward<Args>(args)...);
+        return cp;
+    }
+
+    std::size_t gapLen() const {
+        return gapEnd_ - gapStart_;
+    }
+    std::size_t phys(std::size_t i) const {
+        return i < gapStart_ ? i : i + gapLen();
+    }
+
+    // Удваивает ёмкость, сохраняя разрыв на месте курсора
+    void grow(std::size_t extra) {
+        std::size_t cap = buf_.GetSize();
+        std::size_t len = cap - gapLen();
+        std::size_t newCap = cap ? cap * 2 : 16;
+        while (newCap < len + extra) newCap *= 2;
+        DynamicArray<T> nb(newCap);
+        for (std::size_t i = 0; i < gapStart_; ++i)
+            nb[i] = std::move(buf_[i]);
+        std::size_t tail = cap - gapEnd_;
+        for (std::size_t i = 0; i < tail; ++i)
+            nb[newCap - tail + i] = std::move(buf_[gapEnd_ + i]);
+        buf_ = std::move(nb);
+        gapEnd_ = newCap - tail;
+    }
+
+    void checkIndex(std::size_t i, const char* where) const {
+        if (i >= GetLength()) throw std::out_of_range(where);
+    }
+
+    // p указывает в буфер — такой аргумент сдвинется при MoveCursor или пропадёт при grow
+    bool aliases(const T* p) const {
+        const T* b = buf_.Data();
+        std::less<const T*> lt;
+        return b && !lt(p, b) && lt(p, b + buf_.GetSize());
+    }
+
+public:
+    // --- Конструкторы ---
+    GapBufferSequence() = default;
+    GapBufferSequence(const T* p, std::size_t n) {
+        AppendRange(p, n);
+    }
+
+    // --- Курсор ---
+    std::size_t GetCursor() const {
+        return gapStart_;
+    }
+
+    // Переносит разрыв в позицию pos: O(|pos - курсор|)
+    void MoveCursor(std::size_t pos) {
+        if (pos > GetLength()) throw std::out_of_range("GapBufferSequence::MoveCursor: bad position");
+        if (gapLen() == 0) {
+            // Разрыва нет — переносить нечего (иначе элемент перемещался бы сам в себя)
+            gapStart_ = gapEnd_ = pos;
+            return;
+        }
+        while (gapStart_ > pos)
+            buf_[--gapEnd_] = std::move(buf_[--gapStart_]);
+        while (gapStart_ < pos)
+            buf_[gapStart_++] = std::move(buf_[gapEnd_++]);
+    }
+
+    // Вставка перед курсором, курсор остаётся за вставленным элементом
+    void Insert(const T& v) {
+        if (aliases(&v)) {
+            T copy = v;
+            Insert(copy);
+            return;
+        }
+        if (gapLen() == 0) grow(1);
+        buf_[gapStart_++] = v;
+    }
+
+    // Удаление элемента перед курсором (Backspace)
+    T DeleteBefore() {
+        if (gapStart_ == 0) throw std::out_of_range("GapBufferSequence::DeleteBefore: cursor at start");
+        return std::move(buf_[--gapStart_]);
+    }
+
+    // Удаление элемента после курсора (Delete)
+    T DeleteAfter() {
+        if (gapEnd_ == buf_.GetSize()) throw std::out_of_range("GapBufferSequence::DeleteAfter: cursor at end");
+        return std::move(buf_[gapEnd_++]);
+    }
+
+    T RemoveAt(std::size_t idx) {
+        checkIndex(idx, "GapBufferSequence::RemoveAt: bad index");
+        MoveCursor(idx);
+        return DeleteAfter();
+    }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return buf_.GetSize() - gapLen();
+    }
+    T Get(std::size_t i) const override {
+        checkIndex(i, "GapBufferSequence::Get: bad index");
+        return buf_[phys(i)];
+    }
+    T GetFirst() const override {
+        checkIndex(0, "GapBufferSequence::GetFirst: empty");
+        return buf_[phys(0)];
+    }
+    T GetLast() const override {
+        checkIndex(0, "GapBufferSequence::GetLast: empty");
+        return buf_[phys(GetLength() - 1)];
+    }
+
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= GetLength())
+            throw std::out_of_range("GapBufferSequence::GetSubsequence: bad range");
+        auto out = std::make_unique<GapBufferSequence<T>>();
+        out->grow(r - l + 1);
+        for (std::size_t i = l; i <= r; ++i)
+            out->Insert(buf_[phys(i)]);
+        return out;
+    }
+
+    // --- Клонирование ---
+    SeqUPtr Clone() const override {
+        return std::make_unique<GapBufferSequence<T>>(*this);
+    }
+    Sequence<T>* Instance() override {
+        return new GapBufferSequence<T>();
+    }
+
+    // --- Mutable API: все вставки идут через перенос курсора ---
+    void Append(const T& v) override {
+        InsertAt(v, GetLength());
+    }
+    void Prepend(const T& v) override {
+        InsertAt(v, 0);
+    }
+    void InsertAt(const T& v, std::size_t idx) override {
+        if (idx > GetLength()) throw std::out_of_range("GapBufferSequence::InsertAt: bad idx");
+        if (aliases(&v)) {
+            T copy = v;
+            InsertAt(copy, idx);
+            return;
+        }
+        MoveCursor(idx);
+        Insert(v);
+    }
+    void AppendRange(const T* items, std::size_t count) override {
+        if (count && aliases(items)) {
+            DynamicArray<T> copy(items, count);
+            AppendRange(copy.Data(), count);
+            return;
+        }
+        MoveCursor(GetLength());
+        if (gapLen() < count) grow(count);
+        for (std::size_t i = 0; i < count; ++i)
+            buf_[gapStart_++] = items[i];
+    }
+    Sequence<T>* Concat(Sequence<T>* other) override {
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            Append(other->Get(i));
+        return this;
+    }
+
+    // --- Immutable API ---
+    SeqUPtr Append(const T& v) const override {
+        return cloneInvoke(static_cast<void (GapBufferSequence::*)(const T&)>(&GapBufferSequence::Append), v);
+    }
+    SeqUPtr Prepend(const T& v) const override {
+        return cloneInvoke(static_cast<void (GapBufferSequence::*)(const T&)>(&GapBufferSequence::Prepend), v);
+    }
+    SeqUPtr InsertAt(const T& v, std::size_t idx) const override {
+        return cloneInvoke(static_cast<void (GapBufferSequence::*)(const T&, std::size_t)>(&GapBufferSequence::InsertAt), v, idx);
+    }
+    SeqUPtr Concat(const Sequence<T>* other) const override {
+        auto cp = Clone();
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            static_cast<GapBufferSequence<T>*>(cp.get())->Append(other->Get(i));
+        return cp;
+    }
+
+    // --- Операторы доступа ---
+    T& operator[](std::size_t i) override {
+        checkIndex(i, "GapBufferSequence::operator[]: bad index");
+        return buf_[phys(i)];
+    }
+    const T& operator[](std::size_t i) const override {
+        checkIndex(i, "GapBufferSequence::operator[] const: bad index");
+        return buf_[phys(i)];
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, T& out) const override {
+        if (i >= GetLength()) return false;
+        out = buf_[phys(i)];
+        return true;
+    }
+    bool TryGetFirst(T& out) const override {
+        return TryGet(0, out);
+    }
+    bool TryGetLast(T& out) const override {
+        std::size_t n = GetLength();
+        if (n == 0) return false;
+        return TryGet(n - 1, out);
+    }
+    bool TryFind(std::function<bool(const T&)> pred, T& out) const override {
+        std::size_t n = GetLength();
+        for (std::size_t i = 0; i < n; ++i) {
+            const T& v = buf_[phys(i)];
+            if (pred(v)) {
+                out = v;
+                return true;
+            }
+        }
+        return false;
+    }
+};
@@ -0,0 +1,184 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "Queue.hpp"
+#include "ListSequence.hpp"
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+// Ленивый генератор на корутинах C++20: значения вычисляются по одному по мере
+// чтения, промежуточные последовательности не создаются. Читается через
+// range-for либо Next/ReadChunk — как читатели из StreamReader.hpp,
+// поэтому работает с ReadInto/ReduceChunked. Только перемещается.
+template<typename T>
+class Generator {
+public:
+    using value_type = T;
+
+    struct promise_type {
+        const T* current{nullptr};  // указывает на значение co_yield, пока корутина приостановлена
+        std::exception_ptr error;
+
+        Generator get_return_object() {
+            return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        std::suspend_always yield_value(const T& v) noexcept {
+            current = std::addressof(v);
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception() { error = std::current_exception(); }
+    };
+
+private:
+    using Handle = std::coroutine_handle<promise_type>;
+    Handle h_;
+
+    explicit Generator(Handle h) : h_(h) {}
+
+    // Следующее значение; false — генератор исчерпан
+    bool advance() {
+        if (!h_ || h_.done()) return false;
+        h_.resume();
+        if (h_.promise().error) std::rethrow_exception(std::exchange(h_.promise().error, nullptr));
+        return !h_.done();
+    }
+
+public:
+    Generator(Generator&& o) noexcept : h_(std::exchange(o.h_, nullptr)) {}
+    Generator& operator=(Generator&& o) noexcept {
+        if (this != &o) {
+            if (h_) h_.destroy();
+            h_ = std::exchange(o.h_, nullptr);
+        }
+        return *this;
+    }
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    ~Generator() {
+        if (h_) h_.destroy();
+    }
+
+    // --- Чтение по одному и чанками ---
+    bool Next(T& out) {
+        if (!advance()) return false;
+        out = *h_.promise().current;
+        return true;
+    }
+
+    std::size_t ReadChunk(T* dst, std::size_t max) {
+        std::size_t n = 0;
+        while (n < max && Next(dst[n])) ++n;
+        return n;
+    }
+
+    // --- range-for ---
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+
+        Iterator() = default;
+        explicit Iterator(Generator* g) : g_(g) {}
+
+        const T& operator*() const { return *g_->h_.promise().current; }
+        Iterator& operator++() {
+            if (!g_->advance()) g_ = nullptr;
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(std::default_sentinel_t) const { return g_ == nullptr; }
+
+    private:
+        Generator* g_{nullptr};
+    };
+
+    Iterator begin() {
+        Iterator it(this);
+        return ++it;
+    }
+    std::default_sentinel_t end() { return {}; }
+};
+
+// --- Источники ---
+
+// Элементы последовательности по порядку (seq должна жить, пока читается генератор).
+// Общая версия идёт по индексам — O(1) на шаг у массивов; списки выбирают
+// перегрузку ниже, которая идёт итератором по узлам
+template<typename T>
+Generator<T> FromSequence(const Sequence<T>& seq) {
+    std::size_t n = seq.GetLength();
+    for (std::size_t i = 0; i < n; ++i)
+        co_yield seq.Get(i);
+}
+
+template<typename T, typename Derived, typename List>
+Generator<T> FromSequence(const ListSequence<T, Derived, List>& seq) {
+    for (const T& v : seq.GetList())
+        co_yield v;
+}
+
+// Забирает элементы из очереди, пока она не опустеет
+template<typename T>
+Generator<T> Drain(QueueSequence<T>& q) {
+    while (q.GetLength() > 0)
+        co_yield q.Dequeue();
+}
+
+// Поток читателя из StreamReader.hpp (NumberReader, LineReader, RecordReader)
+template<typename Reader, typename T = typename Reader::value_type>
+Generator<T> FromReader(Reader& r) {
+    T v;
+    while (r.Next(v))
+        co_yield v;
+}
+
+// --- Ленивые Map/Where/Take и терминальные операции ---
+
+template<typename T, typename U, typename F>
+Generator<U> Map(Generator<T> src, F f) {
+    for (const T& v : src)
+        co_yield f(v);
+}
+
+template<typename T, typename Pred>
+Generator<T> Where(Generator<T> src, Pred pred) {
+    for (const T& v : src)
+        if (pred(v)) co_yield v;
+}
+
+template<typename T>
+Generator<T> Take(Generator<T> src, std::size_t count) {
+    if (count == 0) co_return;
+    for (const T& v : src) {
+        co_yield v;
+        if (--count == 0) co_return;
+    }
+}
+
+template<typename T, typename U, typename F>
+U Reduce(Generator<T> src, U init, F f) {
+    U acc = init;
+    for (const T& v : src)
+        acc = f(acc, v);
+    return acc;
+}
+
+// Дописывает всё в out, возвращает число элементов
+template<typename T>
+std::size_t CollectInto(Generator<T> src, Sequence<T>& out) {
+    std::size_t n = 0;
+    for (const T& v : src) {
+        out.Append(v);
+        ++n;
+    }
+    return n;
+}
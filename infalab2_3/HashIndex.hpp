@@ -0,0 +1,135 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "MutableArraySequence.hpp"
+#include "OpenHashMap.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+// Хеш-индекс над последовательностью по ключу key(элемент).
+// Ключ -> цепочка позиций с этим ключом (в порядке следования), поиск за O(1) в среднем.
+// Дописанные в конец последовательности элементы индексируются при следующем запросе;
+// после других изменений (Prepend, InsertAt, запись по индексу) нужен Rebuild().
+template<typename T, typename K>
+class HashIndex {
+private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    struct Chain {
+        std::size_t first{npos};
+        std::size_t last{npos};
+        std::size_t count{0};
+    };
+
+    const Sequence<T>* seq_;
+    std::function<K(const T&)> key_;
+    OpenHashMap<K, Chain> map_;
+    DynamicArray<std::size_t> next_;   // следующая позиция с тем же ключом
+    std::size_t indexed_{0};
+
+    void add(std::size_t pos, const T& v) {
+        if (pos >= next_.GetSize())
+            next_.Resize(next_.GetSize() ? next_.GetSize() * 2 : 16);
+        next_[pos] = npos;
+        Chain& c = map_[key_(v)];
+        if (c.count == 0) c.first = pos;
+        else              next_[c.last] = pos;
+        c.last = pos;
+        ++c.count;
+    }
+
+    const Chain* chain(const K& key) {
+        Refresh();
+        return map_.Find(key);
+    }
+
+public:
+    using SeqUPtr = typename Sequence<T>::SeqUPtr;
+
+    // --- Конструктор ---
+    HashIndex(const Sequence<T>& seq, std::function<K(const T&)> key)
+      : seq_(&seq), key_(std::move(key))
+    {
+        Rebuild();
+    }
+
+    // --- Синхронизация с последовательностью ---
+    // Индексирует элементы, дописанные с прошлого вызова
+    void Refresh() {
+        std::size_t n = seq_->GetLength();
+        if (n < indexed_) {
+            Rebuild();
+            return;
+        }
+        for (std::size_t i = indexed_; i < n; ++i)
+            add(i, seq_->Get(i));
+        indexed_ = n;
+    }
+
+    void Rebuild() {
+        std::size_t n = seq_->GetLength();
+        map_.Clear();
+        map_.Reserve(n);
+        next_ = DynamicArray<std::size_t>(n);
+        std::size_t pos = 0;
+        seq_->ForEach([&](const T& v){ add(pos++, v); });
+        indexed_ = n;
+    }
+
+    // --- Запросы ---
+    bool Contains(const K& key) {
+        return chain(key) != nullptr;
+    }
+
+    std::size_t Count(const K& key) {
+        const Chain* c = chain(key);
+        return c ? c->count : 0;
+    }
+
+    // Позиция первого элемента с ключом либо npos
+    std::size_t IndexOf(const K& key) {
+        const Chain* c = chain(key);
+        return c ? c->first : npos;
+    }
+
+    bool TryFind(const K& key, T& out) {
+        const Chain* c = chain(key);
+        if (!c) return false;
+        out = seq_->Get(c->first);
+        return true;
+    }
+
+    T Find(const K& key) {
+        T out;
+        if (!TryFind(key, out))
+            throw std::runtime_error("HashIndex::Find: no matching element");
+        return out;
+    }
+
+    // Все элементы с ключом в порядке следования
+    SeqUPtr FindAll(const K& key) {
+        auto out = std::make_unique<MutableArraySequence<T>>();
+        const Chain* c = chain(key);
+        if (!c) return out;
+        for (std::size_t p = c->first; p != npos; p = next_[p])
+            out->Append(seq_->Get(p));
+        return out;
+    }
+
+    // --- Статистика памяти ---
+    std::size_t GetLength() const {
+        return indexed_;
+    }
+    std::size_t GetKeyCount() const {
+        return map_.GetLength();
+    }
+    std::size_t MemoryUsage() const {
+        return map_.MemoryUsage() + next_.GetSize() * sizeof(std::size_t);
+    }
+    double MemoryPerElement() const {
+        return indexed_ ? static_cast<double>(MemoryUsage()) / indexed_ : 0.0;
+    }
+};
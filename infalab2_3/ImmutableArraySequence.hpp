@@ -22,4 +22,31 @@ public:
     void Prepend(const T&) override           { throw std::logic_error("Immutable"); }
     void InsertAt(const T&, std::size_t) override  { throw std::logic_error("Immutable"); }
     Sequence<T>* Concat(Sequence<T>*) override{ throw std::logic_error("Immutable"); }
+    void Overwrite(const T*) override         { throw std::logic_error("Immutable"); }
+
+    // --- Immutable API: клон разделяет буфер, пишется уже в его копию ---
+    SeqUPtr Append(const T& v) const override {
+        return InsertAt(v, this->GetLength());
+    }
+    SeqUPtr Prepend(const T& v) const override {
+        return InsertAt(v, 0);
+    }
+    SeqUPtr InsertAt(const T& v, std::size_t idx) const override {
+        auto n = this->GetLength();
+        if (idx > n) throw std::out_of_range("ImmutableArraySequence::InsertAt: bad idx");
+        auto cp = std::make_unique<ImmutableArraySequence<T>>(*this);
+        cp->data_.Resize(n + 1);
+        T* d = cp->data_.Data();
+        array_detail::shiftRight(d + idx, n - idx);
+        d[idx] = v;
+        return cp;
+    }
+    SeqUPtr Concat(const Sequence<T>* other) const override {
+        auto n = this->GetLength(), m = other->GetLength();
+        auto cp = std::make_unique<ImmutableArraySequence<T>>(*this);
+        cp->data_.Resize(n + m);
+        for (std::size_t i = 0; i < m; ++i)
+            cp->data_.Set(n + i, other->Get(i));
+        return cp;
+    }
 };
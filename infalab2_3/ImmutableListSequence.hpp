@@ -4,11 +4,11 @@
 #include <stdexcept>
 
 
-template<typename T>
+template<typename T, typename List = LinkedList<T>>
 class ImmutableListSequence
-  : public ListSequence<T, ImmutableListSequence<T>>
+  : public ListSequence<T, ImmutableListSequence<T, List>, List>
 {
-    using Base = ListSequence<T, ImmutableListSequence<T>>;
+    using Base = ListSequence<T, ImmutableListSequence<T, List>, List>;
 
 public:
     using Base::Base;            
@@ -22,4 +22,5 @@ public:
     void Prepend(const T&) override           { throw std::logic_error("Immutable"); }
     void InsertAt(const T&, std::size_t) override  { throw std::logic_error("Immutable"); }
     Sequence<T>* Concat(Sequence<T>*) override { throw std::logic_error("Immutable"); }
+    void Overwrite(const T*) override          { throw std::logic_error("Immutable"); }
 };
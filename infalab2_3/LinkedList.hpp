@@ -117,6 +117,20 @@ public:
         ++len_;
     }
 
+    // Снятие головы за O(1)
+    T RemoveFirst() {
+        if (!head_)
+            throw std::out_of_range("LinkedList::RemoveFirst: empty");
+        Node* n = head_;
+        T v = std::move(n->val);
+        head_ = n->next;
+        if (!head_)
+            tail_ = nullptr;
+        delete n;
+        --len_;
+        return v;
+    }
+
     void InsertAt(const T& v, std::size_t idx) {
         if (idx > len_)
             throw std::out_of_range("LinkedList::InsertAt: bad idx");
@@ -148,6 +162,49 @@ public:
         return out;
     }
 
+    // Восходящая сортировка слиянием: перевязывает узлы, без выделения памяти, устойчивая
+    template<typename Compare>
+    void MergeSort(Compare cmp) {
+        if (len_ < 2) return;
+        Node* list = head_;
+        for (std::size_t width = 1; ; width *= 2) {
+            Node* p = list;
+            Node* tail = nullptr;
+            std::size_t merges = 0;
+            list = nullptr;
+            while (p) {
+                ++merges;
+                Node* q = p;
+                std::size_t psize = 0;
+                while (psize < width && q) {
+                    ++psize;
+                    q = q->next;
+                }
+                std::size_t qsize = width;
+                while (psize > 0 || (qsize > 0 && q)) {
+                    Node* e;
+                    if (psize == 0) {
+                        e = q; q = q->next; --qsize;
+                    } else if (qsize == 0 || !q || !cmp(q->val, p->val)) {
+                        e = p; p = p->next; --psize;
+                    } else {
+                        e = q; q = q->next; --qsize;
+                    }
+                    if (tail) tail->next = e;
+                    else      list = e;
+                    tail = e;
+                }
+                p = q;
+            }
+            tail->next = nullptr;
+            if (merges <= 1) {
+                head_ = list;
+                tail_ = tail;
+                return;
+            }
+        }
+    }
+
     // --- Операторы индексации ---
     T& operator[](std::size_t idx) {
         if (idx >= len_)
@@ -165,4 +222,22 @@ public:
     Node* getHead() const {
         return head_;
     }
+
+    // --- Обход по узлам ---
+    class ConstIterator {
+    public:
+        explicit ConstIterator(const Node* n) : node_(n) {}
+        const T& operator*() const { return node_->val; }
+        ConstIterator& operator++() {
+            node_ = node_->next;
+            return *this;
+        }
+        bool operator==(const ConstIterator& o) const { return node_ == o.node_; }
+        bool operator!=(const ConstIterator& o) const { return node_ != o.node_; }
+    private:
+        const Node* node_;
+    };
+
+    ConstIterator begin() const { return ConstIterator(head_); }
+    ConstIterator end() const   { return ConstIterator(nullptr); }
 };
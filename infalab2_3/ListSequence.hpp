@@ -2,29 +2,30 @@
 
 #include "Sequence.hpp"
 #include "LinkedList.hpp"
+#include "PooledLinkedList.hpp"
 #include <stdexcept>
 #include <functional>
 
-template<typename T, typename Derived>
+// List — реализация списка: LinkedList (узлы в куче) или PooledLinkedList
+// (узлы в общем пуле с 32-битными ссылками)
+template<typename T, typename Derived, typename List = LinkedList<T>>
 class ListSequence : public Sequence<T> {
 protected:
-    LinkedList<T> data_;
+    List data_;
 
     using SeqUPtr = typename Sequence<T>::SeqUPtr;
 
-    template<typename M, typename... Args>
-    SeqUPtr cloneInvoke(M method, Args&&... args) const {
-        auto cp = Clone();
-        (static_cast<Derived*>(cp.get())->*method)(std::forward<Args>(args)...);
-        return cp;
-    }
-
 public:
     using SeqUPtrPublic = SeqUPtr;
 
     ListSequence() = default;
     ListSequence(const T* p, std::size_t n) : data_(p, n) {}
 
+    // Список узлов — для обхода без виртуальных вызовов (см. algorithms.hpp)
+    const List& GetList() const {
+        return data_;
+    }
+
     std::size_t GetLength() const override {
         return data_.GetLength();
     }
@@ -43,12 +44,11 @@ public:
             throw std::out_of_range("ListSequence::GetSubsequence: bad range");
 
         auto out = std::make_unique<Derived>();
-        auto cur = data_.getHead();
-        for (std::size_t idx = 0; idx <= r; ++idx) {
+        auto cur = data_.begin();
+        for (std::size_t idx = 0; idx <= r; ++idx, ++cur) {
             if (idx >= l) {
-                out->Append(cur->val);
+                static_cast<ListSequence*>(out.get())->data_.Append(*cur);
             }
-            cur = cur->next;
         }
         return out;
     }
@@ -80,20 +80,27 @@ public:
     }
 
  
-    // Immutable API 
+    // Immutable API: пишем прямо в список клона, минуя переопределения
+    // наследника (у ImmutableListSequence мутабельные методы запрещены)
     SeqUPtr Append(const T& v) const override {
-        return cloneInvoke(static_cast<void (Derived::*)(const T&)>(&Derived::Append), v);
+        auto cp = Clone();
+        static_cast<ListSequence*>(cp.get())->data_.Append(v);
+        return cp;
     }
     SeqUPtr Prepend(const T& v) const override {
-        return cloneInvoke(static_cast<void (Derived::*)(const T&)>(&Derived::Prepend), v);
+        auto cp = Clone();
+        static_cast<ListSequence*>(cp.get())->data_.Prepend(v);
+        return cp;
     }
     SeqUPtr InsertAt(const T& v, std::size_t idx) const override {
-        return cloneInvoke(static_cast<void (Derived::*)(const T&, std::size_t)>(&Derived::InsertAt), v, idx);
+        auto cp = Clone();
+        static_cast<ListSequence*>(cp.get())->data_.InsertAt(v, idx);
+        return cp;
     }
     SeqUPtr Concat(const Sequence<T>* other) const override {
         auto cp = Clone();
         for (std::size_t i = 0; i < other->GetLength(); ++i) {
-            static_cast<Derived*>(cp.get())->Append(other->Get(i));
+            static_cast<ListSequence*>(cp.get())->data_.Append(other->Get(i));
         }
         return cp;
     }
@@ -101,6 +108,10 @@ public:
     T& operator[](std::size_t i) override {
         return data_[i];
     }
+    // Один проход построения вместо поиска узла на каждый индекс
+    void Overwrite(const T* items) override {
+        data_ = List(items, data_.GetLength());
+    }
     const T& operator[](std::size_t i) const override {
         return data_.Get(i);
     }
@@ -122,14 +133,23 @@ public:
         return true;
     }
     bool TryFind(std::function<bool(const T&)> pred, T& out) const override {
-        auto cur = data_.getHead();
-        while (cur) {
-            if (pred(cur->val)) {
-                out = cur->val;
+        for (const T& v : data_) {
+            if (pred(v)) {
+                out = v;
                 return true;
             }
-            cur = cur->next;
         }
         return false;
     }
+    void ForEach(std::function<void(const T&)> f) const override {
+        for (const T& v : data_) f(v);
+    }
+    std::function<bool(T&)> Reader() const override {
+        return [it = data_.begin(), end = data_.end()](T& out) mutable {
+            if (it == end) return false;
+            out = *it;
+            ++it;
+            return true;
+        };
+    }
 };
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Подсказки ядру о характере доступа к отображённым страницам
+enum class AccessHint { Normal, Sequential, Random, WillNeed, DontNeed };
+
+// Массив в файле, отображённом в память (mmap). Интерфейс совпадает с DynamicArray,
+// поэтому годится как хранилище для ArraySequence/MutableArraySequence.
+// Рост — расширение файла (ftruncate) с геометрическим запасом и переотображением.
+template<typename T>
+class MappedArray {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedArray: trivially copyable type required");
+private:
+    int fd_{-1};
+    T* data_{nullptr};
+    std::size_t size_{0};
+    std::size_t capacity_{0};
+    bool named_{false};               // именованный файл: при закрытии обрезается до size_
+    AccessHint hint_{AccessHint::Normal};
+
+    [[noreturn]] static void fail(const char* what) {
+        throw std::runtime_error(std::string("MappedArray: ") + what + ": " + std::strerror(errno));
+    }
+
+    static int openTemp() {
+        const char* dir = std::getenv("TMPDIR");
+        std::string path = std::string(dir && *dir ? dir : "/tmp") + "/infalab-XXXXXX";
+        int fd = ::mkstemp(&path[0]);
+        if (fd < 0) fail("mkstemp");
+        ::unlink(path.c_str());       // файл живёт, пока открыт дескриптор
+        return fd;
+    }
+
+    static int adviceOf(AccessHint h) {
+        switch (h) {
+            case AccessHint::Sequential: return MADV_SEQUENTIAL;
+            case AccessHint::Random:     return MADV_RANDOM;
+            case AccessHint::WillNeed:   return MADV_WILLNEED;
+            case AccessHint::DontNeed:   return MADV_DONTNEED;
+            default:                     return MADV_NORMAL;
+        }
+    }
+
+    void unmap() {
+        if (data_) ::munmap(data_, capacity_ * sizeof(T));
+        data_ = nullptr;
+    }
+
+    // Новое отображение создаётся до снятия старого: при ошибке массив остаётся прежним
+    void remap(std::size_t newCap) {
+        if (::ftruncate(fd_, static_cast<off_t>(newCap * sizeof(T))) != 0) fail("ftruncate");
+        T* fresh = nullptr;
+        if (newCap) {
+            void* p = ::mmap(nullptr, newCap * sizeof(T), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+            if (p == MAP_FAILED) fail("mmap");
+            fresh = static_cast<T*>(p);
+            if (hint_ != AccessHint::Normal)
+                ::madvise(fresh, newCap * sizeof(T), adviceOf(hint_));
+        }
+        unmap();
+        data_ = fresh;
+        capacity_ = newCap;
+    }
+
+    void release() {
+        unmap();
+        if (fd_ >= 0) {
+            if (named_) {
+                int rc = ::ftruncate(fd_, static_cast<off_t>(size_ * sizeof(T)));
+                (void)rc;
+            }
+            ::close(fd_);
+        }
+        fd_ = -1;
+        size_ = capacity_ = 0;
+    }
+
+public:
+    // --- Конструкторы и деструктор ---
+    // Анонимное хранилище во временном файле (удаляется при закрытии)
+    MappedArray() : fd_(openTemp()) {}
+
+    explicit MappedArray(std::size_t size) : MappedArray() {
+        Resize(size);
+    }
+
+    MappedArray(const T* items, std::size_t count) : MappedArray() {
+        Reserve(count);
+        if (count) std::memcpy(data_, items, count * sizeof(T));
+        size_ = count;
+    }
+
+    // Именованный файл: существующее содержимое становится элементами массива
+    // Размер файла должен быть кратен sizeof(T): иначе при закрытии обрезался бы хвост
+    explicit MappedArray(const std::string& path) : named_(true) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0) fail("open");
+        try {
+            struct stat st;
+            if (::fstat(fd_, &st) != 0) fail("fstat");
+            std::size_t bytes = static_cast<std::size_t>(st.st_size);
+            if (bytes % sizeof(T) != 0)
+                throw std::runtime_error("MappedArray: file size is not a multiple of element size");
+            remap(bytes / sizeof(T));
+            size_ = bytes / sizeof(T);
+        } catch (...) {
+            ::close(fd_);
+            fd_ = -1;
+            throw;
+        }
+    }
+
+    MappedArray(const MappedArray& other) : MappedArray(other.data_, other.size_) {
+        hint_ = other.hint_;
+    }
+
+    MappedArray(MappedArray&& o) noexcept
+      : fd_(o.fd_), data_(o.data_), size_(o.size_), capacity_(o.capacity_),
+        named_(o.named_), hint_(o.hint_)
+    {
+        o.fd_ = -1;
+        o.data_ = nullptr;
+        o.size_ = o.capacity_ = 0;
+    }
+
+    ~MappedArray() {
+        release();
+    }
+
+    // --- Операторы присваивания ---
+    MappedArray& operator=(const MappedArray& other) {
+        if (this != &other) {
+            MappedArray tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    MappedArray& operator=(MappedArray&& o) noexcept {
+        if (this != &o) {
+            release();
+            fd_ = o.fd_;       data_ = o.data_;
+            size_ = o.size_;   capacity_ = o.capacity_;
+            named_ = o.named_; hint_ = o.hint_;
+            o.fd_ = -1;
+            o.data_ = nullptr;
+            o.size_ = o.capacity_ = 0;
+        }
+        return *this;
+    }
+
+    // --- Доступ к элементам ---
+    T Get(std::size_t idx) const {
+        if (idx >= size_) throw std::out_of_range("MappedArray::Get: bad index");
+        return data_[idx];
+    }
+
+    void Set(std::size_t idx, const T& value) {
+        if (idx >= size_) throw std::out_of_range("MappedArray::Set: bad index");
+        data_[idx] = value;
+    }
+
+    T* Data()             { return data_; }
+    const T* Data() const { return data_; }
+
+    // --- Размер и ёмкость ---
+    std::size_t GetSize() const {
+        return size_;
+    }
+    std::size_t GetCapacity() const {
+        return capacity_;
+    }
+
+    void Reserve(std::size_t cap) {
+        if (cap > capacity_) remap(cap);
+    }
+
+    void Resize(std::size_t newSize) {
+        if (newSize > capacity_) {
+            std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)) / sizeof(T);
+            std::size_t cap = capacity_ * 2;
+            if (cap < page) cap = page ? page : 1;
+            if (cap < newSize) cap = newSize;
+            remap(cap);
+        }
+        for (std::size_t i = size_; i < newSize; ++i)
+            data_[i] = T();
+        size_ = newSize;
+    }
+
+    // Подсказка madvise; сохраняется и при последующих переотображениях
+    void Advise(AccessHint h) {
+        hint_ = h;
+        if (data_ && ::madvise(data_, capacity_ * sizeof(T), adviceOf(h)) != 0)
+            fail("madvise");
+    }
+
+    // Сброс изменённых страниц на диск
+    void Flush() {
+        if (data_ && ::msync(data_, capacity_ * sizeof(T), MS_SYNC) != 0)
+            fail("msync");
+    }
+
+    // --- Операторы индексации ---
+    T& operator[](std::size_t idx) {
+        if (idx >= size_) throw std::out_of_range("MappedArray::operator[]: bad index");
+        return data_[idx];
+    }
+    const T& operator[](std::size_t idx) const {
+        if (idx >= size_) throw std::out_of_range("MappedArray::operator[] const: bad index");
+        return data_[idx];
+    }
+};
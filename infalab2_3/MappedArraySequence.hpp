@@ -0,0 +1,9 @@
+#pragma once
+
+#include "MutableArraySequence.hpp"
+#include "MappedArray.hpp"
+
+// Изменяемая последовательность, элементы которой лежат в отображённом файле.
+// Подсказки доступа: seq.GetStorage().Advise(AccessHint::Sequential)
+template<typename T>
+using MappedArraySequence = MutableArraySequence<T, MappedArray<T>>;
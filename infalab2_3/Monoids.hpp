@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+// Моноиды для агрегатов: Value — тип агрегата, Identity — нейтральный элемент,
+// Lift — агрегат одного элемента, Combine — ассоциативная операция
+// (коммутативность не требуется: порядок аргументов сохраняется).
+
+template<typename T>
+struct SumMonoid {
+    using Value = T;
+    static Value Identity() { return T(); }
+    static Value Lift(const T& v) { return v; }
+    static Value Combine(const Value& a, const Value& b) { return a + b; }
+};
+
+template<typename T>
+struct MinMonoid {
+    using Value = T;
+    static Value Identity() { return std::numeric_limits<T>::max(); }
+    static Value Lift(const T& v) { return v; }
+    static Value Combine(const Value& a, const Value& b) { return b < a ? b : a; }
+};
+
+template<typename T>
+struct MaxMonoid {
+    using Value = T;
+    static Value Identity() { return std::numeric_limits<T>::lowest(); }
+    static Value Lift(const T& v) { return v; }
+    static Value Combine(const Value& a, const Value& b) { return a < b ? b : a; }
+};
+
+// Сумма, минимум, максимум и число элементов за один проход
+template<typename T>
+struct RangeStats {
+    T sum;
+    T min;
+    T max;
+    std::size_t count;
+};
+
+template<typename T>
+struct StatsMonoid {
+    using Value = RangeStats<T>;
+    static Value Identity() {
+        return {T(), std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest(), 0};
+    }
+    static Value Lift(const T& v) { return {v, v, v, 1}; }
+    static Value Combine(const Value& a, const Value& b) {
+        return {a.sum + b.sum, b.min < a.min ? b.min : a.min, a.max < b.max ? b.max : a.max,
+                a.count + b.count};
+    }
+};
@@ -1,42 +1,66 @@
 #pragma once
 
 #include "ArraySequence.hpp"
-#include "DynamicArray.hpp"
+#include "CowArray.hpp"
+#include <functional>
 #include <stdexcept>
+#include <utility>
 
-template<typename T>
+template<typename T, typename Storage = CowArray<T>>
 class MutableArraySequence
-  : public ArraySequence<T, MutableArraySequence<T>>
+  : public ArraySequence<T, MutableArraySequence<T, Storage>, Storage>
 {
-    using Base = ArraySequence<T, MutableArraySequence<T>>;
+    using Base = ArraySequence<T, MutableArraySequence<T, Storage>, Storage>;
+
+    // p указывает в собственный буфер: Resize может его освободить, а сдвиг — перезаписать
+    bool aliases(const T* p) const {
+        const T* b = std::as_const(this->data_).Data();
+        std::less<const T*> lt;
+        return b && !lt(p, b) && lt(p, b + this->GetLength());
+    }
+
 public:
     using Base::Base;  
 
     void Append(const T& v) override {
+        if (aliases(&v)) {
+            T copy = v;
+            Append(copy);
+            return;
+        }
         auto n = this->GetLength();
         this->data_.Resize(n + 1);
         this->data_.Set(n, v);
     }
 
-    void Prepend(const T& v) override {
+    void AppendRange(const T* items, std::size_t count) override {
+        if (count && aliases(items)) {
+            DynamicArray<T> copy(items, count);
+            AppendRange(copy.Data(), count);
+            return;
+        }
         auto n = this->GetLength();
-        DynamicArray<T> tmp(n + 1);
-        tmp.Set(0, v);
-        for (std::size_t i = 0; i < n; ++i)
-            tmp.Set(i + 1, this->data_.Get(i));
-        this->data_ = std::move(tmp);
+        this->data_.Resize(n + count);
+        array_detail::copyRange(this->data_.Data() + n, items, count);
     }
 
+    void Prepend(const T& v) override {
+        InsertAt(v, 0);
+    }
+
+    // Сдвиг хвоста на месте (memmove для тривиальных T): не требует второго экземпляра хранилища
     void InsertAt(const T& v, std::size_t idx) override {
         auto n = this->GetLength();
         if (idx > n) throw std::out_of_range("MutableArraySequence::InsertAt: bad idx");
-        DynamicArray<T> tmp(n + 1);
-        for (std::size_t i = 0; i < idx; ++i)
-            tmp.Set(i, this->data_.Get(i));
-        tmp.Set(idx, v);
-        for (std::size_t i = idx; i < n; ++i)
-            tmp.Set(i + 1, this->data_.Get(i));
-        this->data_ = std::move(tmp);
+        if (aliases(&v)) {
+            T copy = v;
+            InsertAt(copy, idx);
+            return;
+        }
+        this->data_.Resize(n + 1);
+        T* d = this->data_.Data();
+        array_detail::shiftRight(d + idx, n - idx);
+        d[idx] = v;
     }
 
     Sequence<T>* Concat(Sequence<T>* other) override {
@@ -45,3 +69,11 @@ public:
         return this;
     }
 };
+
+// Массив с явно заданными политиками хранилища (см. DynamicArray.hpp), например
+// PolicyArraySequence<float, DoublingGrowth, UncheckedBounds, AlignedAllocator<64>>
+template<typename T,
+         typename Growth = DoublingGrowth,
+         typename Bounds = CheckedBounds,
+         typename Alloc = NewAllocator>
+using PolicyArraySequence = MutableArraySequence<T, CowArray<T, DynamicArray<T, Growth, Bounds, Alloc>>>;
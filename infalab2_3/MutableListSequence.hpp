@@ -3,10 +3,25 @@
 #include "ListSequence.hpp"
 
 
-template<typename T>
+template<typename T, typename List = LinkedList<T>>
 class MutableListSequence
-  : public ListSequence<T, MutableListSequence<T>>
+  : public ListSequence<T, MutableListSequence<T, List>, List>
 {
 public:
-    using ListSequence<T, MutableListSequence<T>>::ListSequence;
+    using ListSequence<T, MutableListSequence<T, List>, List>::ListSequence;
+
+    // Снятие первого элемента за O(1)
+    T PopFront() {
+        return this->data_.RemoveFirst();
+    }
+
+    // Устойчивая сортировка перевязкой узлов списка
+    template<typename Compare>
+    void Sort(Compare cmp) {
+        this->data_.MergeSort(cmp);
+    }
 };
+
+// Список в пуле с 32-битными ссылками (см. PooledLinkedList.hpp)
+template<typename T>
+using PooledListSequence = MutableListSequence<T, PooledLinkedList<T>>;
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+// Хеш-таблица с открытой адресацией и линейным пробированием.
+// Ёмкость — степень двойки, коэффициент заполнения не выше 3/4. Удаления нет:
+// таблица рассчитана на построение индексов и группировок.
+template<typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>>
+class OpenHashMap {
+public:
+    struct Slot {
+        K key{};
+        V value{};
+        bool used{false};
+    };
+
+private:
+    DynamicArray<Slot> slots_;
+    std::size_t size_{0};
+    std::size_t mask_{0};
+    Hash hash_;
+    Eq eq_;
+
+    // Перемешивание (финализатор MurmurHash3): std::hash для целых — тождественный
+    static std::size_t mix(std::size_t h) {
+        std::uint64_t x = h;
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return static_cast<std::size_t>(x);
+    }
+
+    std::size_t findSlot(const K& key) const {
+        std::size_t i = mix(hash_(key)) & mask_;
+        while (slots_[i].used && !eq_(slots_[i].key, key))
+            i = (i + 1) & mask_;
+        return i;
+    }
+
+    void rehash(std::size_t newCap) {
+        DynamicArray<Slot> old(std::move(slots_));
+        slots_ = DynamicArray<Slot>(newCap);
+        mask_ = newCap - 1;
+        for (std::size_t i = 0; i < old.GetSize(); ++i) {
+            if (!old[i].used) continue;
+            std::size_t j = findSlot(old[i].key);
+            slots_[j] = std::move(old[i]);
+        }
+    }
+
+    static std::size_t capacityFor(std::size_t n) {
+        std::size_t cap = 8;
+        while (cap * 3 < n * 4 + 4) cap <<= 1;
+        return cap;
+    }
+
+public:
+    // --- Конструкторы ---
+    OpenHashMap() = default;
+    explicit OpenHashMap(std::size_t expected) {
+        Reserve(expected);
+    }
+
+    // --- Размер ---
+    std::size_t GetLength() const {
+        return size_;
+    }
+    std::size_t GetCapacity() const {
+        return slots_.GetSize();
+    }
+    // Байт, занятых слотами таблицы
+    std::size_t MemoryUsage() const {
+        return slots_.GetSize() * sizeof(Slot);
+    }
+
+    void Reserve(std::size_t n) {
+        std::size_t cap = capacityFor(n);
+        if (cap > slots_.GetSize()) rehash(cap);
+    }
+
+    void Clear() {
+        slots_ = DynamicArray<Slot>();
+        size_ = mask_ = 0;
+    }
+
+    // --- Поиск ---
+    V* Find(const K& key) {
+        if (size_ == 0) return nullptr;
+        std::size_t i = findSlot(key);
+        return slots_[i].used ? &slots_[i].value : nullptr;
+    }
+    const V* Find(const K& key) const {
+        if (size_ == 0) return nullptr;
+        std::size_t i = findSlot(key);
+        return slots_[i].used ? &slots_[i].value : nullptr;
+    }
+    bool Contains(const K& key) const {
+        return Find(key) != nullptr;
+    }
+
+    // --- Вставка ---
+    // Возвращает значение по ключу, вставляя V() при отсутствии; inserted — была ли вставка
+    V& FindOrInsert(const K& key, bool& inserted) {
+        if ((size_ + 1) * 4 > slots_.GetSize() * 3)
+            rehash(capacityFor(size_ + 1 > 2 * size_ ? size_ + 1 : 2 * size_));
+        std::size_t i = findSlot(key);
+        inserted = !slots_[i].used;
+        if (inserted) {
+            slots_[i].used = true;
+            slots_[i].key = key;
+            slots_[i].value = V();
+            ++size_;
+        }
+        return slots_[i].value;
+    }
+
+    V& operator[](const K& key) {
+        bool inserted;
+        return FindOrInsert(key, inserted);
+    }
+
+    // Вставка без перезаписи: false, если ключ уже есть
+    bool Insert(const K& key, const V& value) {
+        bool inserted;
+        V& slot = FindOrInsert(key, inserted);
+        if (inserted) slot = value;
+        return inserted;
+    }
+
+    // --- Обход занятых слотов: f(key, value) ---
+    template<typename F>
+    void ForEach(F f) const {
+        for (std::size_t i = 0; i < slots_.GetSize(); ++i)
+            if (slots_[i].used) f(slots_[i].key, slots_[i].value);
+    }
+};
@@ -0,0 +1,295 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+// Односвязный список в пуле: значения и ссылки лежат в двух непрерывных
+// массивах (vals_, next_), ссылка — 32-битный индекс, так что на элемент
+// приходится ровно 4 байта сверх T и нет заголовков аллокатора на каждый узел.
+// Освобождённые ячейки связаны во встроенный список свободных (через next_)
+// и переиспользуются. Не более 2^32 - 1 элементов.
+// После множества вставок в середину порядок ячеек расходится с порядком
+// списка — Compact() раскладывает список по пулу подряд.
+// Интерфейс — как у LinkedList, подключается в ListSequence третьим параметром.
+template<typename T>
+class PooledLinkedList {
+public:
+    using Index = std::uint32_t;
+    static constexpr Index npos = static_cast<Index>(-1);
+
+private:
+    DynamicArray<T> vals_;
+    DynamicArray<Index> next_;
+    Index head_{npos};
+    Index tail_{npos};
+    Index free_{npos};
+    std::size_t len_{0};
+
+    Index allocNode(const T& v) {
+        Index i;
+        if (free_ != npos) {
+            i = free_;
+            free_ = next_.Data()[i];
+            vals_.Data()[i] = v;
+        } else {
+            std::size_t n = vals_.GetSize();
+            if (n >= npos)
+                throw std::length_error("PooledLinkedList: pool exhausted");
+            T copy = v;  // v может быть элементом этого же списка, а рост пула переносит vals_
+            vals_.Resize(n + 1);
+            next_.Resize(n + 1);
+            i = static_cast<Index>(n);
+            vals_.Data()[i] = std::move(copy);
+        }
+        next_.Data()[i] = npos;
+        return i;
+    }
+
+    void freeNode(Index i) {
+        vals_.Data()[i] = T();
+        next_.Data()[i] = free_;
+        free_ = i;
+    }
+
+    Index nodeAt(std::size_t idx) const {
+        Index cur = head_;
+        for (std::size_t i = 0; i < idx; ++i)
+            cur = next_.Data()[cur];
+        return cur;
+    }
+
+public:
+    // --- Конструкторы ---
+    PooledLinkedList() = default;
+
+    PooledLinkedList(const T* items, std::size_t count) {
+        Reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            Append(items[i]);
+    }
+
+    PooledLinkedList(const std::initializer_list<T>& init)
+      : PooledLinkedList(init.begin(), init.size()) {}
+
+    // Копия раскладывается по пулу подряд, свободные ячейки не копируются
+    PooledLinkedList(const PooledLinkedList& other) {
+        Reserve(other.len_);
+        for (const T& v : other)
+            Append(v);
+    }
+
+    PooledLinkedList& operator=(const PooledLinkedList& other) {
+        if (this != &other) {
+            PooledLinkedList tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    PooledLinkedList(PooledLinkedList&& o) noexcept
+      : vals_(std::move(o.vals_)), next_(std::move(o.next_)),
+        head_(std::exchange(o.head_, npos)), tail_(std::exchange(o.tail_, npos)),
+        free_(std::exchange(o.free_, npos)), len_(std::exchange(o.len_, 0)) {}
+
+    PooledLinkedList& operator=(PooledLinkedList&& o) noexcept {
+        if (this != &o) {
+            vals_ = std::move(o.vals_);
+            next_ = std::move(o.next_);
+            head_ = std::exchange(o.head_, npos);
+            tail_ = std::exchange(o.tail_, npos);
+            free_ = std::exchange(o.free_, npos);
+            len_ = std::exchange(o.len_, 0);
+        }
+        return *this;
+    }
+
+    // --- Пул ---
+    void Reserve(std::size_t n) {
+        vals_.Reserve(n);
+        next_.Reserve(n);
+    }
+
+    // Ячеек в пуле (занятых и свободных)
+    std::size_t GetPoolSize() const {
+        return vals_.GetSize();
+    }
+
+    std::size_t MemoryUsage() const {
+        return vals_.GetCapacity() * sizeof(T) + next_.GetCapacity() * sizeof(Index);
+    }
+
+    // Раскладывает элементы по пулу в порядке списка, отбрасывает свободные ячейки
+    void Compact() {
+        PooledLinkedList tmp(*this);
+        *this = std::move(tmp);
+    }
+
+    void Clear() {
+        *this = PooledLinkedList();
+    }
+
+    // --- Доступ к данным ---
+    std::size_t GetLength() const {
+        return len_;
+    }
+
+    const T& Get(std::size_t idx) const {
+        if (idx >= len_)
+            throw std::out_of_range("PooledLinkedList::Get: bad index");
+        return vals_.Data()[nodeAt(idx)];
+    }
+
+    T GetFirst() const {
+        if (head_ == npos)
+            throw std::out_of_range("PooledLinkedList::GetFirst: empty");
+        return vals_.Data()[head_];
+    }
+
+    T GetLast() const {
+        if (tail_ == npos)
+            throw std::out_of_range("PooledLinkedList::GetLast: empty");
+        return vals_.Data()[tail_];
+    }
+
+    // --- Модификаторы ---
+    void Append(const T& v) {
+        Index n = allocNode(v);
+        if (head_ == npos) {
+            head_ = tail_ = n;
+        } else {
+            next_.Data()[tail_] = n;
+            tail_ = n;
+        }
+        ++len_;
+    }
+
+    void Prepend(const T& v) {
+        Index n = allocNode(v);
+        next_.Data()[n] = head_;
+        head_ = n;
+        if (tail_ == npos)
+            tail_ = n;
+        ++len_;
+    }
+
+    void InsertAt(const T& v, std::size_t idx) {
+        if (idx > len_)
+            throw std::out_of_range("PooledLinkedList::InsertAt: bad idx");
+        if (idx == 0) {
+            Prepend(v);
+            return;
+        }
+        if (idx == len_) {
+            Append(v);
+            return;
+        }
+        Index cur = nodeAt(idx - 1);
+        Index n = allocNode(v);
+        next_.Data()[n] = next_.Data()[cur];
+        next_.Data()[cur] = n;
+        ++len_;
+    }
+
+    // Снятие головы за O(1); ячейка уходит в список свободных
+    T RemoveFirst() {
+        if (head_ == npos)
+            throw std::out_of_range("PooledLinkedList::RemoveFirst: empty");
+        Index n = head_;
+        T v = std::move(vals_.Data()[n]);
+        head_ = next_.Data()[n];
+        if (head_ == npos)
+            tail_ = npos;
+        freeNode(n);
+        --len_;
+        return v;
+    }
+
+    PooledLinkedList* Concat(const PooledLinkedList* other) const {
+        PooledLinkedList* out = new PooledLinkedList(*this);
+        out->Reserve(len_ + other->len_);
+        for (const T& v : *other)
+            out->Append(v);
+        return out;
+    }
+
+    // Восходящая сортировка слиянием перевязкой индексов (как LinkedList::MergeSort)
+    template<typename Compare>
+    void MergeSort(Compare cmp) {
+        if (len_ < 2) return;
+        Index* next = next_.Data();
+        const T* vals = vals_.Data();
+        Index list = head_;
+        for (std::size_t width = 1; ; width *= 2) {
+            Index p = list;
+            Index tail = npos;
+            std::size_t merges = 0;
+            list = npos;
+            while (p != npos) {
+                ++merges;
+                Index q = p;
+                std::size_t psize = 0;
+                while (psize < width && q != npos) {
+                    ++psize;
+                    q = next[q];
+                }
+                std::size_t qsize = width;
+                while (psize > 0 || (qsize > 0 && q != npos)) {
+                    Index e;
+                    if (psize == 0) {
+                        e = q; q = next[q]; --qsize;
+                    } else if (qsize == 0 || q == npos || !cmp(vals[q], vals[p])) {
+                        e = p; p = next[p]; --psize;
+                    } else {
+                        e = q; q = next[q]; --qsize;
+                    }
+                    if (tail != npos) next[tail] = e;
+                    else              list = e;
+                    tail = e;
+                }
+                p = q;
+            }
+            next[tail] = npos;
+            if (merges <= 1) {
+                head_ = list;
+                tail_ = tail;
+                return;
+            }
+        }
+    }
+
+    // --- Операторы индексации ---
+    T& operator[](std::size_t idx) {
+        if (idx >= len_)
+            throw std::out_of_range("PooledLinkedList::operator[]: bad index");
+        return vals_.Data()[nodeAt(idx)];
+    }
+
+    const T& operator[](std::size_t idx) const {
+        return Get(idx);
+    }
+
+    // --- Обход по узлам ---
+    class ConstIterator {
+    public:
+        ConstIterator(const T* vals, const Index* next, Index cur)
+          : vals_(vals), next_(next), cur_(cur) {}
+        const T& operator*() const { return vals_[cur_]; }
+        ConstIterator& operator++() {
+            cur_ = next_[cur_];
+            return *this;
+        }
+        bool operator==(const ConstIterator& o) const { return cur_ == o.cur_; }
+        bool operator!=(const ConstIterator& o) const { return cur_ != o.cur_; }
+    private:
+        const T* vals_;
+        const Index* next_;
+        Index cur_;
+    };
+
+    ConstIterator begin() const { return ConstIterator(vals_.Data(), next_.Data(), head_); }
+    ConstIterator end() const   { return ConstIterator(vals_.Data(), next_.Data(), npos); }
+};
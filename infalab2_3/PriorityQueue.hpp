@@ -0,0 +1,270 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// d-арная куча на DynamicArray: Top — наименьший элемент по Compare.
+// D = 4 или 8 уменьшает высоту кучи и число промахов кеша при Pop.
+template<typename T, std::size_t D = 4, typename Compare = std::less<T>>
+class PriorityQueue {
+    static_assert(D >= 2, "PriorityQueue: arity must be at least 2");
+private:
+    DynamicArray<T> heap_;
+    std::size_t size_{0};
+    Compare cmp_;
+
+    void grow() {
+        heap_.Resize(heap_.GetSize() ? heap_.GetSize() * 2 : 16);
+    }
+
+    void siftUp(std::size_t i) {
+        T* a = heap_.Data();
+        T v = std::move(a[i]);
+        while (i > 0) {
+            std::size_t parent = (i - 1) / D;
+            if (!cmp_(v, a[parent])) break;
+            a[i] = std::move(a[parent]);
+            i = parent;
+        }
+        a[i] = std::move(v);
+    }
+
+    void siftDown(std::size_t i) {
+        T* a = heap_.Data();
+        T v = std::move(a[i]);
+        for (;;) {
+            std::size_t first = i * D + 1;
+            if (first >= size_) break;
+            std::size_t last = first + D < size_ ? first + D : size_;
+            std::size_t best = first;
+            for (std::size_t c = first + 1; c < last; ++c)
+                if (cmp_(a[c], a[best])) best = c;
+            if (!cmp_(a[best], v)) break;
+            a[i] = std::move(a[best]);
+            i = best;
+        }
+        a[i] = std::move(v);
+    }
+
+public:
+    // --- Конструкторы ---
+    PriorityQueue() = default;
+    explicit PriorityQueue(Compare cmp) : cmp_(std::move(cmp)) {}
+
+    // Построение кучи за O(n) (просеивание снизу вверх по Флойду)
+    explicit PriorityQueue(const Sequence<T>& src, Compare cmp = Compare())
+      : heap_(src.GetLength()), size_(src.GetLength()), cmp_(std::move(cmp))
+    {
+        std::size_t i = 0;
+        src.ForEach([&](const T& v) { heap_[i++] = v; });   // один проход и для списков
+        Heapify();
+    }
+
+    PriorityQueue(const T* items, std::size_t count, Compare cmp = Compare())
+      : heap_(items, count), size_(count), cmp_(std::move(cmp))
+    {
+        Heapify();
+    }
+
+    // --- Состояние ---
+    std::size_t GetLength() const { return size_; }
+    bool IsEmpty() const { return size_ == 0; }
+
+    void Reserve(std::size_t n) {
+        if (n > heap_.GetSize()) heap_.Resize(n);
+    }
+
+    void Heapify() {
+        if (size_ < 2) return;
+        for (std::size_t i = (size_ - 2) / D + 1; i-- > 0; )
+            siftDown(i);
+    }
+
+    // --- Операции ---
+    void Push(const T& v) {
+        if (size_ == heap_.GetSize()) grow();
+        heap_[size_] = v;
+        siftUp(size_++);
+    }
+
+    const T& Top() const {
+        if (size_ == 0) throw std::out_of_range("PriorityQueue::Top: empty");
+        return heap_[0];
+    }
+
+    T Pop() {
+        if (size_ == 0) throw std::out_of_range("PriorityQueue::Pop: empty");
+        T top = std::move(heap_[0]);
+        if (--size_ > 0) {
+            heap_[0] = std::move(heap_[size_]);
+            siftDown(0);
+        }
+        return top;
+    }
+
+    bool TryPop(T& out) {
+        if (size_ == 0) return false;
+        out = Pop();
+        return true;
+    }
+};
+
+// d-арная куча с дескрипторами: Push возвращает Handle, по которому
+// можно уменьшить ключ (DecreaseKey) или удалить элемент (Erase) за O(log_d n).
+// Дескрипторы снятых элементов уходят в список свободных и выдаются Push снова,
+// так что память растёт с числом живых элементов, а не с числом вставок.
+template<typename T, std::size_t D = 4, typename Compare = std::less<T>>
+class IndexedPriorityQueue {
+    static_assert(D >= 2, "IndexedPriorityQueue: arity must be at least 2");
+public:
+    using Handle = std::size_t;
+
+private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    DynamicArray<T> values_;          // значение по дескриптору
+    DynamicArray<std::size_t> heap_;  // куча дескрипторов
+    DynamicArray<std::size_t> pos_;   // позиция дескриптора в куче либо npos
+    DynamicArray<Handle> free_;       // освободившиеся дескрипторы (стек)
+    std::size_t size_{0};
+    std::size_t handles_{0};          // выдано дескрипторов за всё время роста
+    std::size_t freeCount_{0};
+    Compare cmp_;
+
+    bool less(std::size_t a, std::size_t b) const {
+        return cmp_(values_[heap_[a]], values_[heap_[b]]);
+    }
+    void place(std::size_t i, Handle h) {
+        heap_[i] = h;
+        pos_[h] = i;
+    }
+
+    void siftUp(std::size_t i) {
+        Handle h = heap_[i];
+        while (i > 0) {
+            std::size_t parent = (i - 1) / D;
+            if (!cmp_(values_[h], values_[heap_[parent]])) break;
+            place(i, heap_[parent]);
+            i = parent;
+        }
+        place(i, h);
+    }
+
+    void siftDown(std::size_t i) {
+        Handle h = heap_[i];
+        for (;;) {
+            std::size_t first = i * D + 1;
+            if (first >= size_) break;
+            std::size_t last = first + D < size_ ? first + D : size_;
+            std::size_t best = first;
+            for (std::size_t c = first + 1; c < last; ++c)
+                if (less(c, best)) best = c;
+            if (!cmp_(values_[heap_[best]], values_[h])) break;
+            place(i, heap_[best]);
+            i = best;
+        }
+        place(i, h);
+    }
+
+    void check(Handle h, const char* where) const {
+        if (!Contains(h)) throw std::out_of_range(std::string(where) + ": bad handle");
+    }
+
+    void removeAt(std::size_t i) {
+        Handle h = heap_[i];
+        pos_[h] = npos;
+        if (--size_ > i) {
+            Handle moved = heap_[size_];
+            place(i, moved);
+            siftDown(i);
+            siftUp(pos_[moved]);
+        }
+        values_[h] = T();  // снятое значение не держится до повторной выдачи дескриптора
+        if (freeCount_ == free_.GetSize()) free_.Resize(freeCount_ ? freeCount_ * 2 : 16);
+        free_[freeCount_++] = h;
+    }
+
+public:
+    IndexedPriorityQueue() = default;
+    explicit IndexedPriorityQueue(Compare cmp) : cmp_(std::move(cmp)) {}
+
+    std::size_t GetLength() const { return size_; }
+    bool IsEmpty() const { return size_ == 0; }
+
+    bool Contains(Handle h) const {
+        return h < handles_ && pos_[h] != npos;
+    }
+
+    const T& Get(Handle h) const {
+        check(h, "IndexedPriorityQueue::Get");
+        return values_[h];
+    }
+
+    // Дескриптор снятого ранее элемента может быть выдан снова
+    Handle Push(const T& v) {
+        Handle h;
+        if (freeCount_ > 0) {
+            h = free_[--freeCount_];
+            values_[h] = v;
+        } else {
+            h = handles_;
+            if (h == values_.GetSize()) {
+                T copy = v;  // v может быть значением из values_ (Push(Get(h)))
+                std::size_t cap = h ? h * 2 : 16;
+                values_.Resize(cap);
+                pos_.Resize(cap);
+                values_[h] = std::move(copy);
+            } else {
+                values_[h] = v;
+            }
+            ++handles_;
+        }
+        if (size_ == heap_.GetSize())
+            heap_.Resize(size_ ? size_ * 2 : 16);
+        place(size_, h);
+        siftUp(size_++);
+        return h;
+    }
+
+    Handle TopHandle() const {
+        if (size_ == 0) throw std::out_of_range("IndexedPriorityQueue::TopHandle: empty");
+        return heap_[0];
+    }
+    const T& Top() const {
+        return values_[TopHandle()];
+    }
+
+    T Pop() {
+        Handle h = TopHandle();
+        T top = values_[h];
+        removeAt(0);
+        return top;
+    }
+
+    // Новое значение не должно быть больше текущего
+    void DecreaseKey(Handle h, const T& v) {
+        check(h, "IndexedPriorityQueue::DecreaseKey");
+        if (cmp_(values_[h], v))
+            throw std::invalid_argument("IndexedPriorityQueue::DecreaseKey: key increased");
+        values_[h] = v;
+        siftUp(pos_[h]);
+    }
+
+    // Произвольное изменение значения
+    void Update(Handle h, const T& v) {
+        check(h, "IndexedPriorityQueue::Update");
+        values_[h] = v;
+        siftUp(pos_[h]);
+        siftDown(pos_[h]);
+    }
+
+    void Erase(Handle h) {
+        check(h, "IndexedPriorityQueue::Erase");
+        removeAt(pos_[h]);
+    }
+};
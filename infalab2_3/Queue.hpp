@@ -3,13 +3,14 @@
 #include <memory>
 #include <stdexcept>
 #include <functional>
+#include <utility>
 #include "Sequence.hpp"
 #include "MutableListSequence.hpp"
 
 template<typename T>
 class QueueSequence : public Sequence<T> {
 private:
-    std::unique_ptr<Sequence<T>> seq_;
+    std::unique_ptr<MutableListSequence<T>> seq_;
 
     using SeqUPtr = typename Sequence<T>::SeqUPtr;
 
@@ -49,7 +50,7 @@ public:
     // Clone / Instance 
     SeqUPtr Clone() const override {
         auto cp = std::make_unique<QueueSequence<T>>();
-        cp->seq_ = seq_->Clone();
+        cp->seq_ = std::make_unique<MutableListSequence<T>>(*seq_);
         return cp;
     }
     Sequence<T>* Instance() override {
@@ -66,6 +67,9 @@ public:
     void InsertAt(const T& v, std::size_t idx) override {
         seq_->InsertAt(v, idx);
     }
+    void AppendRange(const T* items, std::size_t count) override {
+        EnqueueRange(items, count);
+    }
     Sequence<T>* Concat(Sequence<T>* other) override {
         for (std::size_t i = 0; i < other->GetLength(); ++i)
             Enqueue(other->Get(i));
@@ -97,17 +101,13 @@ public:
     void Enqueue(const T& v) {
         seq_->Append(v);
     }
+    void EnqueueRange(const T* items, std::size_t count) {
+        seq_->AppendRange(items, count);
+    }
     T Dequeue() {
-        auto len = seq_->GetLength();
-        if (len == 0)
+        if (seq_->GetLength() == 0)
             throw std::out_of_range("QueueSequence::Dequeue: пустая очередь");
-        T front = seq_->GetFirst();
-        if (len == 1) {
-            seq_.reset(Instance());
-        } else {
-            seq_ = seq_->GetSubsequence(1, len - 1);
-        }
-        return front;
+        return seq_->PopFront();
     }
     T Peek() const {
         if (seq_->GetLength() == 0)
@@ -118,8 +118,12 @@ public:
     T& operator[](std::size_t) override {
         throw std::logic_error("operator[] не поддерживается в QueueSequence");
     }
+    // Порядок задаётся Enqueue/Dequeue — переставлять элементы нельзя
+    void Overwrite(const T*) override {
+        throw std::logic_error("Overwrite не поддерживается в QueueSequence");
+    }
     const T& operator[](std::size_t i) const override {
-        return seq_->Get(i);
+        return std::as_const(*seq_)[i];  // ссылка на узел списка, не на временную копию
     }
 
     bool TryGet(std::size_t i, T& out) const override {
@@ -134,6 +138,12 @@ public:
     bool TryFind(std::function<bool(const T&)> pred, T& out) const override {
         return seq_->TryFind(pred, out);
     }
+    void ForEach(std::function<void(const T&)> f) const override {
+        seq_->ForEach(f);
+    }
+    std::function<bool(T&)> Reader() const override {
+        return seq_->Reader();
+    }
 };
 
 template<typename T>
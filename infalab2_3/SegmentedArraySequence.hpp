@@ -0,0 +1,286 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+// Последовательность из блоков фиксированного размера 2^BlockBits элементов и
+// небольшого каталога блоков. Рост — выделение ещё одного блока: существующие
+// элементы не переезжают, поэтому пик памяти при росте — один блок сверх
+// данных (у DynamicArray — старый и новый буфер одновременно), а ссылки и
+// указатели на элементы остаются действительными при Append.
+// InsertAt/Prepend сдвигают значения (O(n)), но память блоков тоже не двигают.
+// Get — O(1): номер блока и смещение в нём берутся из битов индекса.
+// Обход (ForEach, ForEachBlock, Cursor для статических алгоритмов) идёт по блокам.
+// Alloc — политика выделения блоков, как у DynamicArray (например, HugePageAllocator).
+template<typename T, std::size_t BlockBits = 12, typename Alloc = NewAllocator>
+class SegmentedArraySequence : public Sequence<T> {
+public:
+    static constexpr std::size_t kBlock = std::size_t(1) << BlockBits;
+
+private:
+    static constexpr std::size_t kMask = kBlock - 1;
+
+    using SeqUPtr = typename Sequence<T>::SeqUPtr;
+    // Блок резервируется сразу на kBlock элементов и больше не растёт
+    using Block = DynamicArray<T, ExactGrowth, UncheckedBounds, Alloc>;
+
+    DynamicArray<Block> blocks_;
+    std::size_t size_{0};
+
+    template<typename M, typename... Args>
+    SeqUPtr cloneInvoke(M method, Args&&... args) const {
+        auto cp = Clone();
+        (static_cast<SegmentedArraySequence*>(cp.get())->*method)(std::forward<Args>(args)...);
+        return cp;
+    }
+
+    void checkIndex(std::size_t i, const char* where) const {
+        if (i >= size_) throw std::out_of_range(where);
+    }
+
+    T& at(std::size_t i) {
+        return blocks_[i >> BlockBits].Data()[i & kMask];
+    }
+    const T& at(std::size_t i) const {
+        return blocks_[i >> BlockBits].Data()[i & kMask];
+    }
+
+    // Место под элемент с индексом size_: новый блок, если текущий заполнен
+    T& pushSlot() {
+        std::size_t b = size_ >> BlockBits;
+        if (b == blocks_.GetSize()) {
+            blocks_.Resize(b + 1);
+            blocks_[b].Reserve(kBlock);
+        }
+        Block& blk = blocks_[b];
+        blk.Resize(blk.GetSize() + 1);
+        ++size_;
+        return blk.Data()[blk.GetSize() - 1];
+    }
+
+public:
+    // --- Конструкторы ---
+    SegmentedArraySequence() = default;
+    SegmentedArraySequence(const T* p, std::size_t n) {
+        AppendRange(p, n);
+    }
+
+    // Копия резервирует полные блоки, чтобы и у неё Append не двигал элементы
+    SegmentedArraySequence(const SegmentedArraySequence& other) {
+        blocks_.Reserve(other.blocks_.GetSize());
+        other.ForEachBlock([&](const T* block, std::size_t n) {
+            AppendRange(block, n);
+        });
+    }
+    SegmentedArraySequence& operator=(const SegmentedArraySequence& other) {
+        if (this != &other) {
+            SegmentedArraySequence tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+    SegmentedArraySequence(SegmentedArraySequence&&) noexcept = default;
+    SegmentedArraySequence& operator=(SegmentedArraySequence&&) noexcept = default;
+
+    // --- Блоки ---
+    std::size_t GetBlockCount() const {
+        return blocks_.GetSize();
+    }
+
+    // Байт в блоках и каталоге
+    std::size_t MemoryUsage() const {
+        return blocks_.GetSize() * kBlock * sizeof(T) + blocks_.GetCapacity() * sizeof(Block);
+    }
+
+    // f(const T* block, std::size_t n) для каждого блока по порядку
+    template<typename F>
+    void ForEachBlock(F f) const {
+        for (std::size_t b = 0; b < blocks_.GetSize(); ++b)
+            f(static_cast<const T*>(blocks_[b].Data()), blocks_[b].GetSize());
+    }
+    template<typename F>
+    void ForEachBlock(F f) {
+        for (std::size_t b = 0; b < blocks_.GetSize(); ++b)
+            f(blocks_[b].Data(), blocks_[b].GetSize());
+    }
+
+    template<typename F>
+    void ForEach(F f) const {
+        ForEachBlock([&](const T* block, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) f(block[i]);
+        });
+    }
+    template<typename F>
+    void ForEach(F f) {
+        ForEachBlock([&](T* block, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) f(block[i]);
+        });
+    }
+
+    // Курсор по элементам: *it, ++it — как у указателя; блок сменяется раз в kBlock шагов
+    class ConstCursor {
+    public:
+        ConstCursor(const Block* blocks, std::size_t count)
+          : blocks_(blocks), count_(count) {
+            load();
+        }
+        const T& operator*() const { return *p_; }
+        ConstCursor& operator++() {
+            if (++p_ == end_) {
+                ++b_;
+                load();
+            }
+            return *this;
+        }
+    private:
+        void load() {
+            if (b_ < count_) {
+                p_ = blocks_[b_].Data();
+                end_ = p_ + blocks_[b_].GetSize();
+            } else {
+                p_ = end_ = nullptr;
+            }
+        }
+        const Block* blocks_;
+        std::size_t count_;
+        std::size_t b_{0};
+        const T* p_{nullptr};
+        const T* end_{nullptr};
+    };
+
+    ConstCursor Cursor() const {
+        return ConstCursor(blocks_.Data(), blocks_.GetSize());
+    }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return size_;
+    }
+    T Get(std::size_t i) const override {
+        checkIndex(i, "SegmentedArraySequence::Get: bad index");
+        return at(i);
+    }
+    T GetFirst() const override {
+        checkIndex(0, "SegmentedArraySequence::GetFirst: empty");
+        return at(0);
+    }
+    T GetLast() const override {
+        checkIndex(0, "SegmentedArraySequence::GetLast: empty");
+        return at(size_ - 1);
+    }
+
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= size_)
+            throw std::out_of_range("SegmentedArraySequence::GetSubsequence: bad range");
+        auto out = std::make_unique<SegmentedArraySequence>();
+        for (std::size_t i = l; i <= r; ) {
+            std::size_t n = kBlock - (i & kMask);
+            if (n > r + 1 - i) n = r + 1 - i;
+            out->AppendRange(&at(i), n);
+            i += n;
+        }
+        return out;
+    }
+
+    // --- Клонирование ---
+    SeqUPtr Clone() const override {
+        return std::make_unique<SegmentedArraySequence>(*this);
+    }
+    Sequence<T>* Instance() override {
+        return new SegmentedArraySequence();
+    }
+
+    // --- Mutable API ---
+    void Append(const T& v) override {
+        pushSlot() = v;
+    }
+    void AppendRange(const T* items, std::size_t count) override {
+        blocks_.Reserve((size_ + count + kMask) >> BlockBits);
+        for (std::size_t i = 0; i < count; ++i)
+            pushSlot() = items[i];
+    }
+    void Prepend(const T& v) override {
+        InsertAt(v, 0);
+    }
+    // Значения хвоста сдвигаются на одну позицию, блоки остаются на месте
+    void InsertAt(const T& v, std::size_t idx) override {
+        if (idx > size_) throw std::out_of_range("SegmentedArraySequence::InsertAt: bad idx");
+        T copy = v;  // v может ссылаться на сдвигаемый элемент
+        pushSlot();
+        for (std::size_t i = size_ - 1; i > idx; --i)
+            at(i) = std::move(at(i - 1));
+        at(idx) = std::move(copy);
+    }
+    Sequence<T>* Concat(Sequence<T>* other) override {
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            Append(other->Get(i));
+        return this;
+    }
+
+    // Снятие последнего элемента; опустевший блок освобождается
+    T PopBack() {
+        checkIndex(0, "SegmentedArraySequence::PopBack: empty");
+        Block& blk = blocks_[(size_ - 1) >> BlockBits];
+        T v = std::move(blk.Data()[blk.GetSize() - 1]);
+        blk.Resize(blk.GetSize() - 1);
+        if (--size_ % kBlock == 0) blocks_.Resize(blocks_.GetSize() - 1);
+        return v;
+    }
+
+    // --- Immutable API ---
+    SeqUPtr Append(const T& v) const override {
+        return cloneInvoke(static_cast<void (SegmentedArraySequence::*)(const T&)>(&SegmentedArraySequence::Append), v);
+    }
+    SeqUPtr Prepend(const T& v) const override {
+        return cloneInvoke(static_cast<void (SegmentedArraySequence::*)(const T&)>(&SegmentedArraySequence::Prepend), v);
+    }
+    SeqUPtr InsertAt(const T& v, std::size_t idx) const override {
+        return cloneInvoke(static_cast<void (SegmentedArraySequence::*)(const T&, std::size_t)>(&SegmentedArraySequence::InsertAt), v, idx);
+    }
+    SeqUPtr Concat(const Sequence<T>* other) const override {
+        auto cp = Clone();
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            static_cast<SegmentedArraySequence*>(cp.get())->Append(other->Get(i));
+        return cp;
+    }
+
+    // --- Операторы доступа ---
+    T& operator[](std::size_t i) override {
+        checkIndex(i, "SegmentedArraySequence::operator[]: bad index");
+        return at(i);
+    }
+    const T& operator[](std::size_t i) const override {
+        checkIndex(i, "SegmentedArraySequence::operator[] const: bad index");
+        return at(i);
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, T& out) const override {
+        if (i >= size_) return false;
+        out = at(i);
+        return true;
+    }
+    bool TryGetFirst(T& out) const override {
+        return TryGet(0, out);
+    }
+    bool TryGetLast(T& out) const override {
+        if (size_ == 0) return false;
+        return TryGet(size_ - 1, out);
+    }
+    bool TryFind(std::function<bool(const T&)> pred, T& out) const override {
+        for (std::size_t b = 0; b < blocks_.GetSize(); ++b) {
+            const T* block = blocks_[b].Data();
+            for (std::size_t i = 0; i < blocks_[b].GetSize(); ++i) {
+                if (pred(block[i])) {
+                    out = block[i];
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+};
@@ -26,6 +26,41 @@ public:
     virtual void InsertAt(const T& v, std::size_t idx) = 0;
     virtual Sequence<T>* Concat(Sequence<T>* other) = 0;
 
+    // Пакетное добавление: по умолчанию поэлементно, контейнеры переопределяют
+    virtual void AppendRange(const T* items, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i)
+            Append(items[i]);
+    }
+
+    // Обход по порядку: по умолчанию через Get, контейнеры с медленным Get
+    // (списки, сжатые) переопределяют своим последовательным проходом
+    virtual void ForEach(std::function<void(const T&)> f) const {
+        std::size_t n = GetLength();
+        for (std::size_t i = 0; i < n; ++i)
+            f(Get(i));
+    }
+
+    // Курсор для поочерёдного чтения нескольких последовательностей (слияние):
+    // r(out) кладёт следующий элемент в out, false — элементы кончились.
+    // По умолчанию через Get; списки и сжатые переопределяют, как ForEach.
+    // Последовательность должна жить и не меняться, пока курсор читается.
+    virtual std::function<bool(T&)> Reader() const {
+        return [this, i = std::size_t(0)](T& out) mutable {
+            if (i >= GetLength()) return false;
+            out = Get(i++);
+            return true;
+        };
+    }
+
+    // Перезапись всех значений по порядку (items — GetLength() элементов, длина
+    // не меняется): по умолчанию через operator[], списки пересобираются целиком,
+    // неизменяемые последовательности и очередь запрещают
+    virtual void Overwrite(const T* items) {
+        std::size_t n = GetLength();
+        for (std::size_t i = 0; i < n; ++i)
+            (*this)[i] = items[i];
+    }
+
     virtual SeqUPtr Append(const T& v) const = 0;      
     virtual SeqUPtr Prepend(const T& v) const = 0;     
     virtual SeqUPtr InsertAt(const T& v, std::size_t idx) const = 0;
@@ -45,7 +80,7 @@ public:
         using value_type        = T;
         using difference_type   = std::ptrdiff_t;
         using pointer           = const T*;
-        using reference         = const T&;
+        using reference         = T;
 
         Iterator(const Sequence<T>* seq, std::size_t pos)
           : seq_(seq), pos_(pos) {}
@@ -57,7 +92,8 @@ public:
         bool operator!=(const Iterator& o) const {
             return !(*this == o);
         }
-        const T& operator*() const {
+        // По значению: Get возвращает копию, ссылка на неё повисла бы
+        T operator*() const {
             return seq_->Get(pos_);
         }
     private:
@@ -0,0 +1,632 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "sorting.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace sorted_detail {
+
+// Первая позиция в a[0..n), где !(a[i] < v)
+template<typename T, typename Compare>
+std::size_t lowerIn(const T* a, std::size_t n, const T& v, const Compare& cmp) {
+    std::size_t lo = 0, hi = n;
+    while (lo < hi) {
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (cmp(a[mid], v)) lo = mid + 1;
+        else                hi = mid;
+    }
+    return lo;
+}
+
+// Первая позиция в a[0..n), где v < a[i]
+template<typename T, typename Compare>
+std::size_t upperIn(const T* a, std::size_t n, const T& v, const Compare& cmp) {
+    std::size_t lo = 0, hi = n;
+    while (lo < hi) {
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (cmp(v, a[mid])) hi = mid;
+        else                lo = mid + 1;
+    }
+    return lo;
+}
+
+// f может вернуть bool: false прекращает обход
+template<typename F, typename T>
+bool visit(F& f, const T& v) {
+    if constexpr (std::is_same_v<decltype(f(v)), bool>) return f(v);
+    else { f(v); return true; }
+}
+
+} // namespace sorted_detail
+
+// --- Движок 1: плоский отсортированный массив (для данных «в основном на чтение») ---
+template<typename T, typename Compare = std::less<T>>
+class FlatSortedEngine {
+private:
+    DynamicArray<T> data_;   // ёмкость растёт по политике DynamicArray
+    Compare cmp_;
+
+public:
+    FlatSortedEngine() = default;
+
+    std::size_t GetLength() const { return data_.GetSize(); }
+    const Compare& GetCompare() const { return cmp_; }
+
+    const T& Get(std::size_t i) const {
+        if (i >= data_.GetSize()) throw std::out_of_range("FlatSortedEngine::Get: bad index");
+        return data_[i];
+    }
+
+    void Build(const T* items, std::size_t n) {
+        data_ = DynamicArray<T>(items, n);
+        IntroSort(data_.Data(), data_.Data() + n, cmp_);
+    }
+
+    // Вставка после равных элементов: O(log n) поиск + O(n) сдвиг
+    void Insert(const T& v) {
+        T copy = v;   // v может лежать в data_: Resize и сдвиг его затронут
+        std::size_t pos = UpperBound(copy);
+        std::size_t n = data_.GetSize();
+        data_.Resize(n + 1);
+        T* a = data_.Data();
+        for (std::size_t k = n; k > pos; --k) a[k] = std::move(a[k - 1]);
+        a[pos] = std::move(copy);
+    }
+
+    bool Erase(const T& v) {
+        std::size_t pos = LowerBound(v);
+        std::size_t n = data_.GetSize();
+        if (pos == n || cmp_(v, data_[pos])) return false;
+        T* a = data_.Data();
+        for (std::size_t k = pos + 1; k < n; ++k) a[k - 1] = std::move(a[k]);
+        data_.Resize(n - 1);
+        return true;
+    }
+
+    std::size_t LowerBound(const T& v) const {
+        return sorted_detail::lowerIn(data_.Data(), data_.GetSize(), v, cmp_);
+    }
+    std::size_t UpperBound(const T& v) const {
+        return sorted_detail::upperIn(data_.Data(), data_.GetSize(), v, cmp_);
+    }
+
+    template<typename F>
+    void ForEachInRange(std::size_t from, std::size_t to, F f) const {
+        const T* a = data_.Data();
+        for (std::size_t i = from; i < to && i < data_.GetSize(); ++i)
+            if (!sorted_detail::visit(f, a[i])) return;
+    }
+};
+
+// --- Движок 2: B+-дерево со счётчиками поддеревьев (для частых вставок/удалений) ---
+// Листья связаны в список, поэтому диапазон обходится блоками подряд.
+// Счётчики во внутренних узлах дают Get(i) и LowerBound/UpperBound в виде индексов за O(log n).
+template<typename T, typename Compare = std::less<T>>
+class BTreeEngine {
+public:
+    static constexpr std::size_t kLeafCap  = sizeof(T) >= 64 ? 8 : 512 / sizeof(T);
+    static constexpr std::size_t kInnerCap = 32;
+
+private:
+    struct Node {
+        bool leaf;
+        std::size_t n{0};   // ключей в листе / потомков во внутреннем узле
+        explicit Node(bool isLeaf) : leaf(isLeaf) {}
+    };
+    struct Leaf : Node {
+        T keys[kLeafCap];
+        Leaf* prev{nullptr};
+        Leaf* next{nullptr};
+        Leaf() : Node(true) {}
+    };
+    struct Inner : Node {
+        Node* child[kInnerCap];
+        std::size_t count[kInnerCap];   // элементов в поддереве
+        T maxKey[kInnerCap];            // максимум поддерева
+        Inner() : Node(false) {}
+    };
+
+    Node* root_;
+    Leaf* first_;
+    Leaf* last_;
+    std::size_t size_{0};
+    Compare cmp_;
+
+    static Leaf* asLeaf(Node* n)              { return static_cast<Leaf*>(n); }
+    static const Leaf* asLeaf(const Node* n)  { return static_cast<const Leaf*>(n); }
+    static Inner* asInner(Node* n)            { return static_cast<Inner*>(n); }
+    static const Inner* asInner(const Node* n){ return static_cast<const Inner*>(n); }
+
+    static const T& maxOf(const Node* n) {
+        return n->leaf ? asLeaf(n)->keys[n->n - 1] : asInner(n)->maxKey[n->n - 1];
+    }
+    static std::size_t countOf(const Node* n) {
+        if (n->leaf) return n->n;
+        std::size_t s = 0;
+        for (std::size_t i = 0; i < n->n; ++i) s += asInner(n)->count[i];
+        return s;
+    }
+    static void destroy(Node* n) {
+        if (n->leaf) {
+            delete asLeaf(n);
+            return;
+        }
+        Inner* in = asInner(n);
+        for (std::size_t i = 0; i < in->n; ++i) destroy(in->child[i]);
+        delete in;
+    }
+
+    // Первый потомок, в поддереве которого есть элемент >= v (либо n)
+    std::size_t childLower(const Inner* in, const T& v) const {
+        return sorted_detail::lowerIn(in->maxKey, in->n, v, cmp_);
+    }
+    // Первый потомок, в поддереве которого есть элемент > v (либо n)
+    std::size_t childUpper(const Inner* in, const T& v) const {
+        return sorted_detail::upperIn(in->maxKey, in->n, v, cmp_);
+    }
+
+    // --- Вставка ---
+    Node* splitLeaf(Leaf* lf) {
+        Leaf* r = new Leaf();
+        std::size_t mid = lf->n / 2;
+        for (std::size_t k = mid; k < lf->n; ++k) r->keys[k - mid] = std::move(lf->keys[k]);
+        r->n = lf->n - mid;
+        lf->n = mid;
+        r->next = lf->next;
+        if (r->next) r->next->prev = r;
+        else         last_ = r;
+        lf->next = r;
+        r->prev = lf;
+        return r;
+    }
+
+    Node* splitInner(Inner* in) {
+        Inner* r = new Inner();
+        std::size_t mid = in->n / 2;
+        for (std::size_t k = mid; k < in->n; ++k) {
+            r->child[k - mid]  = in->child[k];
+            r->count[k - mid]  = in->count[k];
+            r->maxKey[k - mid] = std::move(in->maxKey[k]);
+        }
+        r->n = in->n - mid;
+        in->n = mid;
+        return r;
+    }
+
+    // Возвращает нового правого соседа, если узел разделился
+    Node* insertRec(Node* node, const T& v) {
+        if (node->leaf) {
+            Leaf* lf = asLeaf(node);
+            std::size_t pos = sorted_detail::upperIn(lf->keys, lf->n, v, cmp_);
+            for (std::size_t k = lf->n; k > pos; --k) lf->keys[k] = std::move(lf->keys[k - 1]);
+            lf->keys[pos] = v;
+            if (++lf->n < kLeafCap) return nullptr;
+            return splitLeaf(lf);
+        }
+        Inner* in = asInner(node);
+        std::size_t i = childUpper(in, v);
+        if (i == in->n) i = in->n - 1;
+        Node* right = insertRec(in->child[i], v);
+        ++in->count[i];
+        if (right) {
+            for (std::size_t k = in->n; k > i + 1; --k) {
+                in->child[k]  = in->child[k - 1];
+                in->count[k]  = in->count[k - 1];
+                in->maxKey[k] = std::move(in->maxKey[k - 1]);
+            }
+            in->child[i + 1]  = right;
+            in->count[i + 1]  = countOf(right);
+            in->count[i]     -= in->count[i + 1];
+            in->maxKey[i + 1] = maxOf(right);
+            ++in->n;
+        }
+        in->maxKey[i] = maxOf(in->child[i]);
+        if (in->n < kInnerCap) return nullptr;
+        return splitInner(in);
+    }
+
+    // --- Удаление ---
+    void removeChild(Inner* in, std::size_t i) {
+        for (std::size_t k = i + 1; k < in->n; ++k) {
+            in->child[k - 1]  = in->child[k];
+            in->count[k - 1]  = in->count[k];
+            in->maxKey[k - 1] = std::move(in->maxKey[k]);
+        }
+        --in->n;
+    }
+
+    // Переносит cnt элементов между соседями l и r (toLeft — из r в конец l)
+    static void shiftLeaf(Leaf* l, Leaf* r, std::size_t cnt, bool toLeft) {
+        if (toLeft) {
+            for (std::size_t k = 0; k < cnt; ++k) l->keys[l->n + k] = std::move(r->keys[k]);
+            for (std::size_t k = cnt; k < r->n; ++k) r->keys[k - cnt] = std::move(r->keys[k]);
+            l->n += cnt;
+            r->n -= cnt;
+        } else {
+            for (std::size_t k = r->n; k-- > 0; ) r->keys[k + cnt] = std::move(r->keys[k]);
+            for (std::size_t k = 0; k < cnt; ++k) r->keys[k] = std::move(l->keys[l->n - cnt + k]);
+            l->n -= cnt;
+            r->n += cnt;
+        }
+    }
+    static void shiftInner(Inner* l, Inner* r, std::size_t cnt, bool toLeft) {
+        if (toLeft) {
+            for (std::size_t k = 0; k < cnt; ++k) {
+                l->child[l->n + k]  = r->child[k];
+                l->count[l->n + k]  = r->count[k];
+                l->maxKey[l->n + k] = std::move(r->maxKey[k]);
+            }
+            for (std::size_t k = cnt; k < r->n; ++k) {
+                r->child[k - cnt]  = r->child[k];
+                r->count[k - cnt]  = r->count[k];
+                r->maxKey[k - cnt] = std::move(r->maxKey[k]);
+            }
+            l->n += cnt;
+            r->n -= cnt;
+        } else {
+            for (std::size_t k = r->n; k-- > 0; ) {
+                r->child[k + cnt]  = r->child[k];
+                r->count[k + cnt]  = r->count[k];
+                r->maxKey[k + cnt] = std::move(r->maxKey[k]);
+            }
+            for (std::size_t k = 0; k < cnt; ++k) {
+                r->child[k]  = l->child[l->n - cnt + k];
+                r->count[k]  = l->count[l->n - cnt + k];
+                r->maxKey[k] = std::move(l->maxKey[l->n - cnt + k]);
+            }
+            l->n -= cnt;
+            r->n += cnt;
+        }
+    }
+
+    // Сливает или выравнивает недозаполненного потомка i с соседом
+    void rebalance(Inner* in, std::size_t i) {
+        Node* c = in->child[i];
+        std::size_t cap = c->leaf ? kLeafCap : kInnerCap;
+        if (c->n >= cap / 4 || in->n < 2) return;
+
+        std::size_t l = (i + 1 < in->n) ? i : i - 1;
+        std::size_t r = l + 1;
+        Node* L = in->child[l];
+        Node* R = in->child[r];
+        std::size_t total = L->n + R->n;
+
+        if (total < cap) {
+            if (L->leaf) {
+                Leaf* ll = asLeaf(L);
+                Leaf* rl = asLeaf(R);
+                shiftLeaf(ll, rl, rl->n, true);
+                ll->next = rl->next;
+                if (ll->next) ll->next->prev = ll;
+                else          last_ = ll;
+                delete rl;
+            } else {
+                shiftInner(asInner(L), asInner(R), R->n, true);
+                delete asInner(R);
+            }
+            in->count[l] += in->count[r];
+            in->maxKey[l] = maxOf(L);
+            removeChild(in, r);
+            return;
+        }
+
+        std::size_t target = total / 2;
+        bool toLeft = L->n < target;
+        std::size_t cnt = toLeft ? target - L->n : L->n - target;
+        if (L->leaf) shiftLeaf(asLeaf(L), asLeaf(R), cnt, toLeft);
+        else         shiftInner(asInner(L), asInner(R), cnt, toLeft);
+        std::size_t both = in->count[l] + in->count[r];
+        in->count[l] = countOf(L);
+        in->count[r] = both - in->count[l];
+        in->maxKey[l] = maxOf(L);
+        in->maxKey[r] = maxOf(R);
+    }
+
+    bool eraseRec(Node* node, const T& v) {
+        if (node->leaf) {
+            Leaf* lf = asLeaf(node);
+            std::size_t pos = sorted_detail::lowerIn(lf->keys, lf->n, v, cmp_);
+            if (pos == lf->n || cmp_(v, lf->keys[pos])) return false;
+            for (std::size_t k = pos + 1; k < lf->n; ++k) lf->keys[k - 1] = std::move(lf->keys[k]);
+            --lf->n;
+            return true;
+        }
+        Inner* in = asInner(node);
+        std::size_t i = childLower(in, v);
+        if (i == in->n || !eraseRec(in->child[i], v)) return false;
+        --in->count[i];
+        if (in->child[i]->n > 0) in->maxKey[i] = maxOf(in->child[i]);
+        rebalance(in, i);
+        return true;
+    }
+
+    // Лист и смещение элемента с индексом idx
+    const Leaf* locate(std::size_t idx, std::size_t& off) const {
+        const Node* node = root_;
+        while (!node->leaf) {
+            const Inner* in = asInner(node);
+            std::size_t k = 0;
+            while (idx >= in->count[k]) {
+                idx -= in->count[k];
+                ++k;
+            }
+            node = in->child[k];
+        }
+        off = idx;
+        return asLeaf(node);
+    }
+
+public:
+    // --- Конструкторы и деструктор ---
+    BTreeEngine() : root_(new Leaf()) {
+        first_ = last_ = asLeaf(root_);
+    }
+
+    BTreeEngine(const BTreeEngine& other) : BTreeEngine() {
+        cmp_ = other.cmp_;
+        for (const Leaf* lf = other.first_; lf; lf = lf->next)
+            for (std::size_t k = 0; k < lf->n; ++k) Insert(lf->keys[k]);
+    }
+
+    BTreeEngine& operator=(const BTreeEngine& other) {
+        if (this != &other) {
+            BTreeEngine tmp(other);
+            std::swap(root_, tmp.root_);
+            std::swap(first_, tmp.first_);
+            std::swap(last_, tmp.last_);
+            std::swap(size_, tmp.size_);
+            std::swap(cmp_, tmp.cmp_);
+        }
+        return *this;
+    }
+
+    ~BTreeEngine() {
+        destroy(root_);
+    }
+
+    std::size_t GetLength() const { return size_; }
+    const Compare& GetCompare() const { return cmp_; }
+
+    const T& Get(std::size_t i) const {
+        if (i >= size_) throw std::out_of_range("BTreeEngine::Get: bad index");
+        std::size_t off;
+        const Leaf* lf = locate(i, off);
+        return lf->keys[off];
+    }
+
+    void Build(const T* items, std::size_t n) {
+        DynamicArray<T> tmp(items, n);
+        IntroSort(tmp.Data(), tmp.Data() + n, cmp_);
+        for (std::size_t i = 0; i < n; ++i) Insert(tmp[i]);
+    }
+
+    void Insert(const T& v) {
+        Node* right = insertRec(root_, v);
+        if (right) {
+            Inner* r = new Inner();
+            r->child[0]  = root_;
+            r->child[1]  = right;
+            r->count[1]  = countOf(right);
+            r->count[0]  = size_ + 1 - r->count[1];
+            r->maxKey[0] = maxOf(root_);
+            r->maxKey[1] = maxOf(right);
+            r->n = 2;
+            root_ = r;
+        }
+        ++size_;
+    }
+
+    bool Erase(const T& v) {
+        if (!eraseRec(root_, v)) return false;
+        --size_;
+        if (!root_->leaf && root_->n == 1) {
+            Inner* old = asInner(root_);
+            root_ = old->child[0];
+            delete old;
+        }
+        return true;
+    }
+
+    std::size_t LowerBound(const T& v) const {
+        std::size_t idx = 0;
+        const Node* node = root_;
+        while (!node->leaf) {
+            const Inner* in = asInner(node);
+            std::size_t k = childLower(in, v);
+            if (k == in->n) return size_;
+            for (std::size_t j = 0; j < k; ++j) idx += in->count[j];
+            node = in->child[k];
+        }
+        return idx + sorted_detail::lowerIn(asLeaf(node)->keys, node->n, v, cmp_);
+    }
+
+    std::size_t UpperBound(const T& v) const {
+        std::size_t idx = 0;
+        const Node* node = root_;
+        while (!node->leaf) {
+            const Inner* in = asInner(node);
+            std::size_t k = childUpper(in, v);
+            if (k == in->n) return size_;
+            for (std::size_t j = 0; j < k; ++j) idx += in->count[j];
+            node = in->child[k];
+        }
+        return idx + sorted_detail::upperIn(asLeaf(node)->keys, node->n, v, cmp_);
+    }
+
+    // Обход позиций [from, to): спуск к первому листу, дальше по цепочке листьев
+    template<typename F>
+    void ForEachInRange(std::size_t from, std::size_t to, F f) const {
+        if (to > size_) to = size_;
+        if (from >= to) return;
+        std::size_t off;
+        const Leaf* lf = locate(from, off);
+        for (std::size_t left = to - from; left > 0; --left) {
+            if (!sorted_detail::visit(f, lf->keys[off])) return;
+            if (++off == lf->n) {
+                lf = lf->next;
+                off = 0;
+            }
+        }
+    }
+};
+
+// --- Отсортированная последовательность ---
+// Append вставляет элемент на место по порядку; Prepend/InsertAt и запись по индексу запрещены.
+template<typename T, typename Engine = FlatSortedEngine<T>>
+class SortedSequence : public Sequence<T> {
+private:
+    Engine eng_;
+
+    using SeqUPtr = typename Sequence<T>::SeqUPtr;
+
+public:
+    SortedSequence() = default;
+    SortedSequence(const T* p, std::size_t n) {
+        eng_.Build(p, n);
+    }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return eng_.GetLength();
+    }
+    T Get(std::size_t i) const override {
+        return eng_.Get(i);
+    }
+    T GetFirst() const override {
+        if (eng_.GetLength() == 0) throw std::out_of_range("SortedSequence::GetFirst: empty");
+        return eng_.Get(0);
+    }
+    T GetLast() const override {
+        if (eng_.GetLength() == 0) throw std::out_of_range("SortedSequence::GetLast: empty");
+        return eng_.Get(eng_.GetLength() - 1);
+    }
+
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= GetLength())
+            throw std::out_of_range("SortedSequence::GetSubsequence: bad range");
+        auto out = std::make_unique<SortedSequence<T, Engine>>();
+        eng_.ForEachInRange(l, r + 1, [&](const T& v){ out->Add(v); });
+        return out;
+    }
+
+    SeqUPtr Clone() const override {
+        return std::make_unique<SortedSequence<T, Engine>>(*this);
+    }
+    Sequence<T>* Instance() override {
+        return new SortedSequence<T, Engine>();
+    }
+
+    // --- Упорядоченный API ---
+    void Add(const T& v) {
+        eng_.Insert(v);
+    }
+    // Удаляет одно вхождение v
+    bool Remove(const T& v) {
+        return eng_.Erase(v);
+    }
+    bool Contains(const T& v) const {
+        std::size_t i = eng_.LowerBound(v);
+        return i < eng_.GetLength() && !eng_.GetCompare()(v, eng_.Get(i));
+    }
+    std::size_t LowerBound(const T& v) const {
+        return eng_.LowerBound(v);
+    }
+    std::size_t UpperBound(const T& v) const {
+        return eng_.UpperBound(v);
+    }
+    std::pair<std::size_t, std::size_t> EqualRange(const T& v) const {
+        return { eng_.LowerBound(v), eng_.UpperBound(v) };
+    }
+    // Количество элементов в отрезке [lo, hi]
+    std::size_t CountRange(const T& lo, const T& hi) const {
+        std::size_t a = eng_.LowerBound(lo), b = eng_.UpperBound(hi);
+        return b > a ? b - a : 0;
+    }
+    // Обход элементов из [lo, hi] по порядку
+    template<typename F>
+    void ForEachInRange(const T& lo, const T& hi, F f) const {
+        eng_.ForEachInRange(eng_.LowerBound(lo), eng_.UpperBound(hi), f);
+    }
+
+    // --- Mutable API ---
+    void Append(const T& v) override {
+        Add(v);
+    }
+    void Prepend(const T&) override {
+        throw std::logic_error("SortedSequence: Prepend unavailable, position is defined by order");
+    }
+    void InsertAt(const T&, std::size_t) override {
+        throw std::logic_error("SortedSequence: InsertAt unavailable, position is defined by order");
+    }
+    Sequence<T>* Concat(Sequence<T>* other) override {
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            Add(other->Get(i));
+        return this;
+    }
+
+    // --- Immutable API ---
+    SeqUPtr Append(const T& v) const override {
+        auto cp = std::make_unique<SortedSequence<T, Engine>>(*this);
+        cp->Add(v);
+        return cp;
+    }
+    SeqUPtr Prepend(const T&) const override {
+        throw std::logic_error("SortedSequence: Prepend unavailable, position is defined by order");
+    }
+    SeqUPtr InsertAt(const T&, std::size_t) const override {
+        throw std::logic_error("SortedSequence: InsertAt unavailable, position is defined by order");
+    }
+    SeqUPtr Concat(const Sequence<T>* other) const override {
+        auto cp = std::make_unique<SortedSequence<T, Engine>>(*this);
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            cp->Add(other->Get(i));
+        return cp;
+    }
+
+    T& operator[](std::size_t) override {
+        throw std::logic_error("SortedSequence: mutable operator[] would break the order");
+    }
+    const T& operator[](std::size_t i) const override {
+        return eng_.Get(i);
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, T& out) const override {
+        if (i >= GetLength()) return false;
+        out = eng_.Get(i);
+        return true;
+    }
+    bool TryGetFirst(T& out) const override {
+        return TryGet(0, out);
+    }
+    bool TryGetLast(T& out) const override {
+        std::size_t n = GetLength();
+        if (n == 0) return false;
+        return TryGet(n - 1, out);
+    }
+    bool TryFind(std::function<bool(const T&)> pred, T& out) const override {
+        bool found = false;
+        eng_.ForEachInRange(0, GetLength(), [&](const T& v){
+            if (!pred(v)) return true;
+            out = v;
+            found = true;
+            return false;
+        });
+        return found;
+    }
+    void ForEach(std::function<void(const T&)> f) const override {
+        eng_.ForEachInRange(0, GetLength(), f);
+    }
+};
+
+template<typename T, typename Compare = std::less<T>>
+using FlatSortedSequence = SortedSequence<T, FlatSortedEngine<T, Compare>>;
+
+template<typename T, typename Compare = std::less<T>>
+using BTreeSortedSequence = SortedSequence<T, BTreeEngine<T, Compare>>;
@@ -0,0 +1,289 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "ImmutableArraySequence.hpp"
+#include <istream>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <charconv>
+#include <functional>
+#include <type_traits>
+#include <stdexcept>
+#include <unistd.h>
+
+constexpr std::size_t kStreamBufferBytes = 1 << 16;   // размер байтового буфера
+constexpr std::size_t kStreamChunk       = 1 << 14;   // элементов в одном чанке
+
+// Буферизованный источник байт поверх std::istream или файлового дескриптора.
+class ByteSource {
+private:
+    std::istream* in_;
+    int fd_;
+    DynamicArray<char> buf_;
+    std::size_t pos_{0};
+    std::size_t end_{0};
+    bool eof_{false};
+
+    bool refill() {
+        if (eof_) return false;
+        std::size_t got = 0;
+        if (in_) {
+            in_->read(&buf_[0], static_cast<std::streamsize>(buf_.GetSize()));
+            got = static_cast<std::size_t>(in_->gcount());
+            if (in_->bad())
+                throw std::runtime_error("ByteSource: stream read failed");
+        } else {
+            ssize_t r;
+            do {
+                r = ::read(fd_, &buf_[0], buf_.GetSize());
+            } while (r < 0 && errno == EINTR);
+            if (r < 0)
+                throw std::runtime_error(std::string("ByteSource: read failed: ") + std::strerror(errno));
+            got = static_cast<std::size_t>(r);
+        }
+        pos_ = 0;
+        end_ = got;
+        if (got == 0) eof_ = true;
+        return got != 0;
+    }
+
+public:
+    explicit ByteSource(std::istream& in, std::size_t bufSize = kStreamBufferBytes)
+      : in_(&in), fd_(-1), buf_(bufSize ? bufSize : 1) {}
+
+    explicit ByteSource(int fd, std::size_t bufSize = kStreamBufferBytes)
+      : in_(nullptr), fd_(fd), buf_(bufSize ? bufSize : 1) {}
+
+    ByteSource(const ByteSource&) = delete;
+    ByteSource& operator=(const ByteSource&) = delete;
+
+    // Следующий байт без извлечения, либо -1 в конце потока
+    int Peek() {
+        if (pos_ == end_ && !refill()) return -1;
+        return static_cast<unsigned char>(buf_[pos_]);
+    }
+    int Get() {
+        if (pos_ == end_ && !refill()) return -1;
+        return static_cast<unsigned char>(buf_[pos_++]);
+    }
+
+    // Читает до n байт, возвращает фактически прочитанное количество
+    std::size_t Read(char* dst, std::size_t n) {
+        std::size_t done = 0;
+        while (done < n) {
+            if (pos_ == end_ && !refill()) break;
+            std::size_t take = end_ - pos_;
+            if (take > n - done) take = n - done;
+            std::memcpy(dst + done, &buf_[pos_], take);
+            pos_ += take;
+            done += take;
+        }
+        return done;
+    }
+};
+
+// --- Читатели: Next() по одному элементу, ReadChunk() пачкой ---
+
+// Числа, разделённые пробельными символами.
+template<typename T>
+class NumberReader {
+    static_assert(std::is_arithmetic_v<T>, "NumberReader: arithmetic type required");
+private:
+    ByteSource src_;
+
+    static bool isSpace(int c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    static T parse(const char* first, const char* last) {
+        T v{};
+        if constexpr (std::is_integral_v<T>) {
+            auto res = std::from_chars(first, last, v);
+            if (res.ec != std::errc() || res.ptr != last)
+                throw std::runtime_error("NumberReader: bad token '" + std::string(first, last) + "'");
+        } else {
+            char* stop = nullptr;
+            long double d = std::strtold(first, &stop);
+            if (stop != last)
+                throw std::runtime_error("NumberReader: bad token '" + std::string(first, last) + "'");
+            v = static_cast<T>(d);
+        }
+        return v;
+    }
+
+public:
+    using value_type = T;
+
+    explicit NumberReader(std::istream& in, std::size_t bufSize = kStreamBufferBytes)
+      : src_(in, bufSize) {}
+    explicit NumberReader(int fd, std::size_t bufSize = kStreamBufferBytes)
+      : src_(fd, bufSize) {}
+
+    bool Next(T& out) {
+        int c = src_.Peek();
+        while (c != -1 && isSpace(c)) { src_.Get(); c = src_.Peek(); }
+        if (c == -1) return false;
+
+        char tok[128];
+        std::size_t len = 0;
+        while (c != -1 && !isSpace(c)) {
+            if (len + 1 >= sizeof(tok))
+                throw std::runtime_error("NumberReader: token too long");
+            tok[len++] = static_cast<char>(src_.Get());
+            c = src_.Peek();
+        }
+        tok[len] = '\0';
+        out = parse(tok, tok + len);
+        return true;
+    }
+
+    std::size_t ReadChunk(T* dst, std::size_t max) {
+        std::size_t n = 0;
+        while (n < max && Next(dst[n])) ++n;
+        return n;
+    }
+};
+
+// Строки, разделённые '\n' (завершающий '\r' отбрасывается).
+class LineReader {
+private:
+    ByteSource src_;
+
+public:
+    using value_type = std::string;
+
+    explicit LineReader(std::istream& in, std::size_t bufSize = kStreamBufferBytes)
+      : src_(in, bufSize) {}
+    explicit LineReader(int fd, std::size_t bufSize = kStreamBufferBytes)
+      : src_(fd, bufSize) {}
+
+    bool Next(std::string& out) {
+        int c = src_.Get();
+        if (c == -1) return false;
+        out.clear();
+        while (c != -1 && c != '\n') {
+            out.push_back(static_cast<char>(c));
+            c = src_.Get();
+        }
+        if (!out.empty() && out.back() == '\r') out.pop_back();
+        return true;
+    }
+
+    std::size_t ReadChunk(std::string* dst, std::size_t max) {
+        std::size_t n = 0;
+        while (n < max && Next(dst[n])) ++n;
+        return n;
+    }
+};
+
+// Двоичные записи фиксированного размера sizeof(T).
+template<typename T>
+class RecordReader {
+    static_assert(std::is_trivially_copyable_v<T>, "RecordReader: trivially copyable type required");
+private:
+    ByteSource src_;
+
+public:
+    using value_type = T;
+
+    explicit RecordReader(std::istream& in, std::size_t bufSize = kStreamBufferBytes)
+      : src_(in, bufSize) {}
+    explicit RecordReader(int fd, std::size_t bufSize = kStreamBufferBytes)
+      : src_(fd, bufSize) {}
+
+    bool Next(T& out) {
+        return ReadChunk(&out, 1) == 1;
+    }
+
+    std::size_t ReadChunk(T* dst, std::size_t max) {
+        std::size_t bytes = src_.Read(reinterpret_cast<char*>(dst), max * sizeof(T));
+        if (bytes % sizeof(T) != 0)
+            throw std::runtime_error("RecordReader: truncated record");
+        return bytes / sizeof(T);
+    }
+};
+
+// --- Загрузка в последовательность ---
+
+// Читает весь поток чанками и дописывает их в out через AppendRange.
+template<typename Reader, typename T = typename Reader::value_type>
+std::size_t ReadInto(Reader& r, Sequence<T>& out, std::size_t chunk = kStreamChunk)
+{
+    if (chunk == 0) throw std::invalid_argument("ReadInto: zero chunk");
+    DynamicArray<T> buf(chunk);
+    std::size_t total = 0;
+    for (;;) {
+        std::size_t n = r.ReadChunk(&buf[0], chunk);
+        if (n == 0) break;
+        out.AppendRange(&buf[0], n);
+        total += n;
+    }
+    return total;
+}
+
+// --- Чанковый режим: память ограничена размером одного чанка ---
+
+template<typename Reader, typename T = typename Reader::value_type>
+void ForEachChunk(
+    Reader& r,
+    std::size_t chunk,
+    std::type_identity_t<std::function<void(const Sequence<T>&)>> f)
+{
+    if (chunk == 0) throw std::invalid_argument("ForEachChunk: zero chunk");
+    DynamicArray<T> buf(chunk);
+    for (;;) {
+        std::size_t n = r.ReadChunk(&buf[0], chunk);
+        if (n == 0) break;
+        const ImmutableArraySequence<T> part(&buf[0], n);
+        f(part);
+    }
+}
+
+template<typename Reader, typename U, typename T = typename Reader::value_type>
+U ReduceChunked(
+    Reader& r,
+    U init,
+    std::type_identity_t<std::function<U(const U&, const T&)>> f,
+    std::size_t chunk = kStreamChunk)
+{
+    if (chunk == 0) throw std::invalid_argument("ReduceChunked: zero chunk");
+    DynamicArray<T> buf(chunk);
+    U acc = init;
+    for (;;) {
+        std::size_t n = r.ReadChunk(&buf[0], chunk);
+        if (n == 0) break;
+        for (std::size_t i = 0; i < n; ++i)
+            acc = f(acc, buf[i]);
+    }
+    return acc;
+}
+
+// Отфильтровывает поток в out; в памяти держится только текущий чанк.
+template<typename Reader, typename T = typename Reader::value_type>
+std::size_t WhereChunked(
+    Reader& r,
+    std::type_identity_t<std::function<bool(const T&)>> pred,
+    Sequence<T>& out,
+    std::size_t chunk = kStreamChunk)
+{
+    if (chunk == 0) throw std::invalid_argument("WhereChunked: zero chunk");
+    DynamicArray<T> buf(chunk);
+    std::size_t total = 0;
+    for (;;) {
+        std::size_t n = r.ReadChunk(&buf[0], chunk);
+        if (n == 0) break;
+        std::size_t k = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (pred(buf[i])) {
+                if (k != i) buf[k] = std::move(buf[i]);
+                ++k;
+            }
+        }
+        if (k) out.AppendRange(&buf[0], k);
+        total += k;
+    }
+    return total;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "OpenHashMap.hpp"
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+// Хранилище символов строк: куски по kChunk байт, строки дописываются подряд
+// без заголовков и без отдельного выделения на каждую. Куски не переезжают,
+// поэтому выданные string_view действительны до Clear() или уничтожения арены.
+// Строка длиннее куска получает собственный кусок.
+// Intern(s) возвращает уже сохранённую копию равной строки, если она есть:
+// повторяющиеся строки хранятся один раз.
+// Копирование запрещено (string_view указывают в куски), перемещение сохраняет их.
+class StringArena {
+public:
+    static constexpr std::size_t kChunk = std::size_t(1) << 16;
+
+private:
+    DynamicArray<DynamicArray<char>> chunks_;
+    std::size_t used_{0};      // занято байт в последнем куске
+    std::size_t bytes_{0};     // всего сохранено символов
+    OpenHashMap<std::string_view, std::string_view> index_;
+
+    char* reserve(std::size_t n) {
+        std::size_t k = chunks_.GetSize();
+        if (k == 0 || used_ + n > chunks_[k - 1].GetSize()) {
+            chunks_.Resize(k + 1);
+            chunks_[k] = DynamicArray<char>(n > kChunk ? n : kChunk);
+            used_ = 0;
+            ++k;
+        }
+        char* p = chunks_[k - 1].Data() + used_;
+        used_ += n;
+        return p;
+    }
+
+public:
+    // --- Конструкторы ---
+    StringArena() = default;
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+    StringArena(StringArena&&) noexcept = default;
+    StringArena& operator=(StringArena&&) noexcept = default;
+
+    // --- Сохранение строк ---
+    std::string_view Add(std::string_view s) {
+        if (s.empty()) return std::string_view();
+        char* p = reserve(s.size());
+        std::memcpy(p, s.data(), s.size());
+        bytes_ += s.size();
+        return std::string_view(p, s.size());
+    }
+
+    std::string_view Intern(std::string_view s) {
+        if (const std::string_view* found = index_.Find(s)) return *found;
+        std::string_view v = Add(s);
+        index_.Insert(v, v);
+        return v;
+    }
+
+    // Освобождает все куски; выданные string_view становятся недействительными
+    void Clear() {
+        chunks_ = DynamicArray<DynamicArray<char>>();
+        used_ = bytes_ = 0;
+        index_.Clear();
+    }
+
+    // --- Размер ---
+    std::size_t GetBytes() const {
+        return bytes_;
+    }
+    std::size_t GetChunkCount() const {
+        return chunks_.GetSize();
+    }
+    // Куски, их каталог и таблица интернирования
+    std::size_t MemoryUsage() const {
+        std::size_t total = chunks_.GetCapacity() * sizeof(DynamicArray<char>) + index_.MemoryUsage();
+        for (std::size_t i = 0; i < chunks_.GetSize(); ++i)
+            total += chunks_[i].GetCapacity();
+        return total;
+    }
+};
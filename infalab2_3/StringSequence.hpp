@@ -0,0 +1,382 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "StringArena.hpp"
+#include "DynamicArray.hpp"
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Последовательность строк: символы всех элементов лежат в одной StringArena,
+// сама последовательность хранит только string_view (16 байт на элемент) в
+// DynamicArray. Вместо выделения std::string на каждый элемент и копии в
+// узле списка — одно копирование символов в арену.
+// Добавляемая строка всегда копируется в арену, так что источник может умереть сразу.
+// С intern = true равные строки хранятся один раз (арена + хеш-таблица).
+// Элементы занимают [head_, views_.GetSize()): PopFront сдвигает head_ за O(1),
+// освободившееся начало переиспользуют Prepend и уплотнение перед ростом.
+// string_view из Get / operator[] действительны, пока жива последовательность.
+// Неконстантный operator[] запрещён (ссылка позволила бы указать мимо арены) — запись через Set.
+class StringSequence : public Sequence<std::string_view> {
+private:
+    using SeqUPtr = typename Sequence<std::string_view>::SeqUPtr;
+
+    StringArena arena_;
+    DynamicArray<std::string_view> views_;
+    std::size_t head_{0};
+    bool intern_{false};
+
+    template<typename M, typename... Args>
+    SeqUPtr cloneInvoke(M method, Args&&... args) const {
+        auto cp = Clone();
+        (static_cast<StringSequence*>(cp.get())->*method)(std::forward<Args>(args)...);
+        return cp;
+    }
+
+    void checkIndex(std::size_t i, const char* where) const {
+        if (i >= GetLength()) throw std::out_of_range(where);
+    }
+
+    std::string_view store(std::string_view s) {
+        return intern_ ? arena_.Intern(s) : arena_.Add(s);
+    }
+
+    // Место под ещё один элемент в конце; свободное начало, если оно не меньше
+    // половины буфера, сначала уплотняется — вместо роста ёмкости
+    void growBack() {
+        std::size_t end = views_.GetSize();
+        if (end == views_.GetCapacity() && head_ * 2 >= end && head_ > 0) {
+            std::string_view* d = views_.Data();
+            for (std::size_t i = head_; i < end; ++i) d[i - head_] = d[i];
+            views_.Resize(end - head_);
+            head_ = 0;
+        }
+        views_.Resize(views_.GetSize() + 1);
+    }
+
+public:
+    // --- Конструкторы ---
+    explicit StringSequence(bool intern = false) : intern_(intern) {}
+
+    StringSequence(const std::string* p, std::size_t n, bool intern = false) : intern_(intern) {
+        views_.Reserve(n);
+        for (std::size_t i = 0; i < n; ++i) Append(p[i]);
+    }
+
+    // Копия собирает свою арену только из живых элементов
+    StringSequence(const StringSequence& other) : intern_(other.intern_) {
+        views_.Reserve(other.GetLength());
+        for (std::size_t i = 0; i < other.GetLength(); ++i)
+            Append(other.Get(i));
+    }
+    StringSequence& operator=(const StringSequence& other) {
+        if (this != &other) {
+            StringSequence tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+    StringSequence(StringSequence&&) noexcept = default;
+    StringSequence& operator=(StringSequence&&) noexcept = default;
+
+    // --- Строки ---
+    bool IsInterning() const {
+        return intern_;
+    }
+
+    void Set(std::size_t i, std::string_view s) {
+        checkIndex(i, "StringSequence::Set: bad index");
+        views_[head_ + i] = store(s);
+    }
+
+    // Снятие первого элемента за O(1); символы остаются в арене до уничтожения последовательности
+    std::string_view PopFront() {
+        checkIndex(0, "StringSequence::PopFront: empty");
+        std::string_view v = views_[head_++];
+        if (head_ == views_.GetSize()) {
+            views_.Resize(0);
+            head_ = 0;
+        }
+        return v;
+    }
+
+    const StringArena& GetArena() const {
+        return arena_;
+    }
+
+    // Арена и буфер string_view с запасом ёмкости
+    std::size_t MemoryUsage() const {
+        return arena_.MemoryUsage() + views_.GetCapacity() * sizeof(std::string_view);
+    }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return views_.GetSize() - head_;
+    }
+    std::string_view Get(std::size_t i) const override {
+        checkIndex(i, "StringSequence::Get: bad index");
+        return views_[head_ + i];
+    }
+    std::string_view GetFirst() const override {
+        checkIndex(0, "StringSequence::GetFirst: empty");
+        return views_[head_];
+    }
+    std::string_view GetLast() const override {
+        checkIndex(0, "StringSequence::GetLast: empty");
+        return views_[views_.GetSize() - 1];
+    }
+
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= GetLength())
+            throw std::out_of_range("StringSequence::GetSubsequence: bad range");
+        auto out = std::make_unique<StringSequence>(intern_);
+        for (std::size_t i = l; i <= r; ++i)
+            out->Append(Get(i));
+        return out;
+    }
+
+    // --- Клонирование ---
+    SeqUPtr Clone() const override {
+        return std::make_unique<StringSequence>(*this);
+    }
+    Sequence<std::string_view>* Instance() override {
+        return new StringSequence(intern_);
+    }
+
+    // --- Mutable API ---
+    void Append(const std::string_view& s) override {
+        std::string_view v = store(s);
+        growBack();
+        views_[views_.GetSize() - 1] = v;
+    }
+    void Prepend(const std::string_view& s) override {
+        if (head_ == 0) {
+            InsertAt(s, 0);
+            return;
+        }
+        views_[--head_] = store(s);
+    }
+    void InsertAt(const std::string_view& s, std::size_t idx) override {
+        if (idx > GetLength()) throw std::out_of_range("StringSequence::InsertAt: bad idx");
+        std::string_view v = store(s);
+        growBack();
+        std::string_view* d = views_.Data();
+        for (std::size_t i = views_.GetSize() - 1; i > head_ + idx; --i) d[i] = d[i - 1];
+        d[head_ + idx] = v;
+    }
+    Sequence<std::string_view>* Concat(Sequence<std::string_view>* other) override {
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            Append(other->Get(i));
+        return this;
+    }
+
+    // --- Immutable API ---
+    SeqUPtr Append(const std::string_view& s) const override {
+        return cloneInvoke(static_cast<void (StringSequence::*)(const std::string_view&)>(&StringSequence::Append), s);
+    }
+    SeqUPtr Prepend(const std::string_view& s) const override {
+        return cloneInvoke(static_cast<void (StringSequence::*)(const std::string_view&)>(&StringSequence::Prepend), s);
+    }
+    SeqUPtr InsertAt(const std::string_view& s, std::size_t idx) const override {
+        return cloneInvoke(static_cast<void (StringSequence::*)(const std::string_view&, std::size_t)>(&StringSequence::InsertAt), s, idx);
+    }
+    SeqUPtr Concat(const Sequence<std::string_view>* other) const override {
+        auto cp = Clone();
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            static_cast<StringSequence*>(cp.get())->Append(other->Get(i));
+        return cp;
+    }
+
+    // --- Операторы доступа ---
+    std::string_view& operator[](std::size_t) override {
+        throw std::logic_error("StringSequence::operator[]: use Set");
+    }
+    const std::string_view& operator[](std::size_t i) const override {
+        checkIndex(i, "StringSequence::operator[] const: bad index");
+        return views_[head_ + i];
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, std::string_view& out) const override {
+        if (i >= GetLength()) return false;
+        out = views_[head_ + i];
+        return true;
+    }
+    bool TryGetFirst(std::string_view& out) const override {
+        return TryGet(0, out);
+    }
+    bool TryGetLast(std::string_view& out) const override {
+        if (GetLength() == 0) return false;
+        return TryGet(GetLength() - 1, out);
+    }
+    bool TryFind(std::function<bool(const std::string_view&)> pred, std::string_view& out) const override {
+        for (std::size_t i = head_; i < views_.GetSize(); ++i) {
+            if (pred(views_[i])) {
+                out = views_[i];
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// Очередь строк на арене. Снятые элементы не освобождаются по одному: когда
+// снятых строк накапливается больше, чем живых (по байтам, а с интернированием —
+// по числу элементов) и больше куска арены, очередной Enqueue пересобирает
+// арену из живых элементов — амортизированно O(1) на снятую строку. Поэтому
+// string_view из Dequeue / Peek / Get действительны до следующей вставки
+// (Enqueue, Prepend, InsertAt) или до уничтожения очереди.
+class StringQueue : public Sequence<std::string_view> {
+private:
+    using SeqUPtr = typename Sequence<std::string_view>::SeqUPtr;
+
+    StringSequence items_;
+    std::size_t deadBytes_{0};   // символов в снятых строках
+    std::size_t deadItems_{0};
+
+    // Пересборка перед вставкой s. s может указывать в старую арену
+    // (q.Enqueue(q.Dequeue())), поэтому перед её освобождением он копируется в keep
+    void reclaim(std::string_view& s, std::string& keep) {
+        if (deadBytes_ <= StringArena::kChunk) return;
+        bool mostlyDead = items_.IsInterning()
+            ? deadItems_ > items_.GetLength()
+            : deadBytes_ > items_.GetArena().GetBytes() - deadBytes_;
+        if (mostlyDead) {
+            keep.assign(s);
+            s = keep;
+            items_ = StringSequence(items_);
+            deadBytes_ = deadItems_ = 0;
+        }
+    }
+
+public:
+    explicit StringQueue(bool intern = false) : items_(intern) {}
+
+    // --- Очередь ---
+    void Enqueue(std::string_view s) {
+        std::string keep;
+        reclaim(s, keep);
+        items_.Append(s);
+    }
+    std::string_view Dequeue() {
+        if (items_.GetLength() == 0)
+            throw std::out_of_range("StringQueue::Dequeue: пустая очередь");
+        std::string_view v = items_.PopFront();
+        deadBytes_ += v.size();
+        ++deadItems_;
+        return v;
+    }
+    std::string_view Peek() const {
+        if (items_.GetLength() == 0)
+            throw std::out_of_range("StringQueue::Peek: пустая очередь");
+        return items_.GetFirst();
+    }
+
+    std::size_t MemoryUsage() const {
+        return items_.MemoryUsage();
+    }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return items_.GetLength();
+    }
+    std::string_view Get(std::size_t i) const override {
+        return items_.Get(i);
+    }
+    std::string_view GetFirst() const override {
+        return items_.GetFirst();
+    }
+    std::string_view GetLast() const override {
+        return items_.GetLast();
+    }
+
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= GetLength())
+            throw std::out_of_range("StringQueue::GetSubsequence: bad range");
+        auto out = std::make_unique<StringQueue>(items_.IsInterning());
+        for (std::size_t i = l; i <= r; ++i)
+            out->Enqueue(items_.Get(i));
+        return out;
+    }
+
+    // --- Клонирование ---
+    SeqUPtr Clone() const override {
+        auto cp = std::make_unique<StringQueue>(items_.IsInterning());
+        cp->items_ = items_;
+        return cp;
+    }
+    Sequence<std::string_view>* Instance() override {
+        return new StringQueue(items_.IsInterning());
+    }
+
+    // --- Mutable API ---
+    void Append(const std::string_view& s) override {
+        Enqueue(s);
+    }
+    void Prepend(const std::string_view& s) override {
+        std::string_view v = s;
+        std::string keep;
+        reclaim(v, keep);
+        items_.Prepend(v);
+    }
+    void InsertAt(const std::string_view& s, std::size_t idx) override {
+        if (idx > GetLength()) throw std::out_of_range("StringQueue::InsertAt: bad idx");
+        std::string_view v = s;
+        std::string keep;
+        reclaim(v, keep);
+        items_.InsertAt(v, idx);
+    }
+    Sequence<std::string_view>* Concat(Sequence<std::string_view>* other) override {
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            Enqueue(other->Get(i));
+        return this;
+    }
+
+    // --- Immutable API ---
+    SeqUPtr Append(const std::string_view& s) const override {
+        auto cp = Clone();
+        static_cast<StringQueue*>(cp.get())->Enqueue(s);
+        return cp;
+    }
+    SeqUPtr Prepend(const std::string_view& s) const override {
+        auto cp = Clone();
+        static_cast<StringQueue*>(cp.get())->Prepend(s);
+        return cp;
+    }
+    SeqUPtr InsertAt(const std::string_view& s, std::size_t idx) const override {
+        auto cp = Clone();
+        static_cast<StringQueue*>(cp.get())->InsertAt(s, idx);
+        return cp;
+    }
+    SeqUPtr Concat(const Sequence<std::string_view>* other) const override {
+        auto cp = Clone();
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            static_cast<StringQueue*>(cp.get())->Enqueue(other->Get(i));
+        return cp;
+    }
+
+    // --- Операторы доступа ---
+    std::string_view& operator[](std::size_t) override {
+        throw std::logic_error("operator[] не поддерживается в StringQueue");
+    }
+    const std::string_view& operator[](std::size_t i) const override {
+        return std::as_const(items_)[i];
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, std::string_view& out) const override {
+        return items_.TryGet(i, out);
+    }
+    bool TryGetFirst(std::string_view& out) const override {
+        return items_.TryGetFirst(out);
+    }
+    bool TryGetLast(std::string_view& out) const override {
+        return items_.TryGetLast(out);
+    }
+    bool TryFind(std::function<bool(const std::string_view&)> pred, std::string_view& out) const override {
+        return items_.TryFind(pred, out);
+    }
+};
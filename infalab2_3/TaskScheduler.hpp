@@ -0,0 +1,391 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "DequeArraySequence.hpp"
+#include "Queue.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+// Деку Чейза–Лева (Chase–Lev): владелец кладёт и снимает с «низа» без блокировок,
+// остальные потоки крадут с «верха» через CAS. T — указатель или другой
+// тривиально копируемый тип. Кольцевой буфер растёт вдвое; старые буферы живут
+// до разрушения деки, потому что вор может ещё читать из них.
+template<typename T>
+class WorkStealingDeque {
+private:
+    struct Buffer {
+        std::int64_t capacity;
+        std::atomic<T>* slots;
+        Buffer* retired;
+
+        Buffer(std::int64_t cap, Buffer* prev)
+          : capacity(cap), slots(new std::atomic<T>[cap]), retired(prev) {}
+        ~Buffer() { delete[] slots; }
+
+        T Get(std::int64_t i) const {
+            return slots[i & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+        void Put(std::int64_t i, T v) {
+            slots[i & (capacity - 1)].store(v, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(64) std::atomic<std::int64_t> top_{0};
+    alignas(64) std::atomic<std::int64_t> bottom_{0};
+    alignas(64) std::atomic<Buffer*> buffer_;
+
+    Buffer* grow(Buffer* old, std::int64_t b, std::int64_t t) {
+        Buffer* fresh = new Buffer(old->capacity * 2, old);
+        for (std::int64_t i = t; i < b; ++i)
+            fresh->Put(i, old->Get(i));
+        buffer_.store(fresh, std::memory_order_release);
+        return fresh;
+    }
+
+public:
+    explicit WorkStealingDeque(std::int64_t capacity = 256)
+      : buffer_(new Buffer(capacity, nullptr))
+    {
+        if (capacity <= 0 || (capacity & (capacity - 1)) != 0)
+            throw std::invalid_argument("WorkStealingDeque: capacity must be a power of two");
+    }
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    ~WorkStealingDeque() {
+        Buffer* b = buffer_.load(std::memory_order_relaxed);
+        while (b) {
+            Buffer* prev = b->retired;
+            delete b;
+            b = prev;
+        }
+    }
+
+    std::size_t GetLength() const {
+        std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        std::int64_t t = top_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<std::size_t>(b - t) : 0;
+    }
+
+    // --- Только поток-владелец ---
+    void Push(T v) {
+        std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        Buffer* a = buffer_.load(std::memory_order_relaxed);
+        if (b - t > a->capacity - 1) a = grow(a, b, t);
+        a->Put(b, v);
+        bottom_.store(b + 1, std::memory_order_release);
+    }
+
+    bool Pop(T& out) {
+        std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* a = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_seq_cst);
+        std::int64_t t = top_.load(std::memory_order_seq_cst);
+        if (t > b) {
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        out = a->Get(b);
+        if (t == b) {
+            // последний элемент: соревнуемся с ворами
+            bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // --- Любой поток ---
+    bool Steal(T& out) {
+        std::int64_t t = top_.load(std::memory_order_seq_cst);
+        std::int64_t b = bottom_.load(std::memory_order_seq_cst);
+        if (t >= b) return false;
+        Buffer* a = buffer_.load(std::memory_order_acquire);
+        T v = a->Get(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed))
+            return false;
+        out = v;
+        return true;
+    }
+};
+
+class TaskScheduler;
+
+// Группа задач: Run добавляет задачу, Wait ждёт завершения всех задач группы,
+// выполняя тем временем чужие задачи (поэтому Wait можно звать изнутри задачи —
+// так строится fork-join). Первое исключение из задач группы пробрасывается из Wait.
+class TaskGroup {
+public:
+    explicit TaskGroup(TaskScheduler& sched) : sched_(sched) {}
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+    ~TaskGroup();
+
+    void Run(std::function<void()> fn);
+    void Wait();
+
+private:
+    friend class TaskScheduler;
+
+    TaskScheduler& sched_;
+    std::atomic<std::size_t> pending_{0};
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+
+    void fail(std::exception_ptr e) {
+        std::lock_guard<std::mutex> lk(errorMutex_);
+        if (!error_) error_ = e;
+    }
+};
+
+// Планировщик с кражей работы: у каждого рабочего потока своя дека Чейза–Лева,
+// задачи извне попадают в общую очередь (DequeArraySequence под мьютексом).
+// Рабочий берёт задачи из своей деки (LIFO — горячий кеш), затем из общей
+// очереди, затем крадёт у соседей (FIFO — крупные куски). Простаивающий поток
+// несколько раз уступает процессор, а потом засыпает (паркуется) до новой задачи.
+class TaskScheduler {
+private:
+    struct Job {
+        std::function<void()> fn;
+        TaskGroup* group;
+    };
+
+    struct Worker {
+        WorkStealingDeque<Job*> deque;
+        std::thread thread;
+        std::uint64_t seed;
+    };
+
+    static constexpr int kSpinRounds = 64;
+
+    DynamicArray<Worker*> workers_;
+    std::mutex injectMutex_;
+    DequeArraySequence<Job*> injected_;
+    std::atomic<std::size_t> injectedCount_{0};
+
+    std::mutex parkMutex_;
+    std::condition_variable parkCv_;
+    std::atomic<std::uint64_t> epoch_{0};
+    std::atomic<std::size_t> sleepers_{0};
+    std::atomic<bool> stop_{false};
+
+    TaskGroup root_;
+
+    friend class TaskGroup;
+
+    // Рабочий текущего потока, если поток принадлежит этому планировщику
+    static Worker*& current() {
+        thread_local Worker* w = nullptr;
+        return w;
+    }
+    static TaskScheduler*& currentScheduler() {
+        thread_local TaskScheduler* s = nullptr;
+        return s;
+    }
+    Worker* self() {
+        return currentScheduler() == this ? current() : nullptr;
+    }
+
+    void wake() {
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+        if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lk(parkMutex_);
+            parkCv_.notify_one();
+        }
+    }
+
+    void schedule(Job* job) {
+        if (Worker* w = self()) {
+            w->deque.Push(job);
+        } else {
+            std::lock_guard<std::mutex> lk(injectMutex_);
+            injected_.Append(job);
+            injectedCount_.fetch_add(1, std::memory_order_release);
+        }
+        wake();
+    }
+
+    bool popInjected(Job*& out) {
+        if (injectedCount_.load(std::memory_order_acquire) == 0) return false;
+        std::lock_guard<std::mutex> lk(injectMutex_);
+        if (injected_.GetLength() == 0) return false;
+        out = injected_.PopFront();
+        injectedCount_.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    bool steal(Worker* w, Job*& out) {
+        std::size_t n = workers_.GetSize();
+        if (n == 0) return false;
+        std::uint64_t r = w ? (w->seed = w->seed * 6364136223846793005ULL + 1442695040888963407ULL) : 0;
+        std::size_t start = static_cast<std::size_t>(r >> 33) % n;
+        for (std::size_t k = 0; k < n; ++k) {
+            Worker* victim = workers_[(start + k) % n];
+            if (victim != w && victim->deque.Steal(out)) return true;
+        }
+        return false;
+    }
+
+    bool findJob(Worker* w, Job*& out) {
+        if (w && w->deque.Pop(out)) return true;
+        if (popInjected(out)) return true;
+        return steal(w, out);
+    }
+
+    void execute(Job* job) {
+        TaskGroup* g = job->group;
+        try {
+            job->fn();
+        } catch (...) {
+            g->fail(std::current_exception());
+        }
+        delete job;
+        g->pending_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    // Выполняет одну задачу, если она нашлась
+    bool runOne() {
+        Job* job;
+        if (!findJob(self(), job)) return false;
+        execute(job);
+        return true;
+    }
+
+    void workerLoop(Worker* w) {
+        currentScheduler() = this;
+        current() = w;
+        int idle = 0;
+        while (!stop_.load(std::memory_order_acquire)) {
+            Job* job;
+            if (findJob(w, job)) {
+                execute(job);
+                idle = 0;
+                continue;
+            }
+            if (++idle < kSpinRounds) {
+                std::this_thread::yield();
+                continue;
+            }
+            // Парковка: эпоха читается до последней проверки очередей,
+            // поэтому задача, пришедшая после проверки, не будет пропущена
+            std::uint64_t e = epoch_.load(std::memory_order_seq_cst);
+            if (findJob(w, job)) {
+                execute(job);
+                idle = 0;
+                continue;
+            }
+            std::unique_lock<std::mutex> lk(parkMutex_);
+            sleepers_.fetch_add(1, std::memory_order_seq_cst);
+            parkCv_.wait(lk, [&] {
+                return epoch_.load(std::memory_order_seq_cst) != e || stop_.load(std::memory_order_acquire);
+            });
+            sleepers_.fetch_sub(1, std::memory_order_seq_cst);
+            idle = 0;
+        }
+    }
+
+public:
+    // workers = 0 — по числу аппаратных потоков
+    explicit TaskScheduler(unsigned workers = 0)
+      : root_(*this)
+    {
+        if (workers == 0) workers = std::thread::hardware_concurrency();
+        if (workers == 0) workers = 1;
+        workers_ = DynamicArray<Worker*>(workers);
+        for (unsigned i = 0; i < workers; ++i) {
+            workers_[i] = new Worker();
+            workers_[i]->seed = 0x9E3779B97F4A7C15ULL * (i + 1);
+        }
+        for (unsigned i = 0; i < workers; ++i) {
+            Worker* w = workers_[i];
+            w->thread = std::thread([this, w] { workerLoop(w); });
+        }
+    }
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    ~TaskScheduler() {
+        try { root_.Wait(); } catch (...) {}
+        stop_.store(true, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lk(parkMutex_);
+            parkCv_.notify_all();
+        }
+        // Сначала дожидаемся всех: остальные ещё могут красть из деки соседа
+        for (std::size_t i = 0; i < workers_.GetSize(); ++i)
+            workers_[i]->thread.join();
+        for (std::size_t i = 0; i < workers_.GetSize(); ++i)
+            delete workers_[i];
+    }
+
+    std::size_t GetWorkerCount() const {
+        return workers_.GetSize();
+    }
+
+    // --- Задачи вне групп ---
+    void Submit(std::function<void()> fn) {
+        root_.Run(std::move(fn));
+    }
+
+    // Забирает всю очередь работ и отправляет её одной пачкой в общую очередь
+    void SubmitAll(QueueSequence<std::function<void()>>& work) {
+        std::size_t n = work.GetLength();
+        if (n == 0) return;
+        root_.pending_.fetch_add(n, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lk(injectMutex_);
+            while (work.GetLength() > 0)
+                injected_.Append(new Job{work.Dequeue(), &root_});
+            injectedCount_.fetch_add(n, std::memory_order_release);
+        }
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+        std::lock_guard<std::mutex> lk(parkMutex_);
+        parkCv_.notify_all();
+    }
+
+    // Ждёт все задачи, отправленные через Submit/SubmitAll
+    void Wait() {
+        root_.Wait();
+    }
+};
+
+inline TaskGroup::~TaskGroup() {
+    try { Wait(); } catch (...) {}
+}
+
+inline void TaskGroup::Run(std::function<void()> fn) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    sched_.schedule(new TaskScheduler::Job{std::move(fn), this});
+}
+
+inline void TaskGroup::Wait() {
+    int idle = 0;
+    while (pending_.load(std::memory_order_acquire) != 0) {
+        if (sched_.runOne()) {
+            idle = 0;
+        } else if (++idle < 64) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+    std::exception_ptr e;
+    {
+        std::lock_guard<std::mutex> lk(errorMutex_);
+        e = std::exchange(error_, nullptr);
+    }
+    if (e) std::rethrow_exception(e);
+}
@@ -0,0 +1,259 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DequeArraySequence.hpp"
+#include "DynamicArray.hpp"
+#include "Monoids.hpp"
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Очередь-окно с агрегатами за амортизированное O(1) на Enqueue/Dequeue и O(1)
+// на чтение:
+//  - GetMin/GetMax — монотонные деки (для упорядочиваемых T);
+//  - GetSum — накапливаемая сумма (для арифметических T);
+//  - Aggregate — произвольный ассоциативный моноид по схеме «двух стеков»:
+//    frontAgg_ хранит агрегаты суффиксов головы очереди (вершина — агрегат
+//    всей головы), backAgg_ — агрегат дописанного после последнего переноса.
+//    Когда голова исчерпана, хвост переносится в неё за O(длины хвоста);
+//    каждый элемент переносится не более одного раза.
+// window = 0 — окно не ограничено; иначе Enqueue в полное окно вытесняет
+// самый старый элемент. Prepend/InsertAt допустимы, но пересчитывают всё за O(n).
+template<typename T, typename Monoid = SumMonoid<T>>
+class WindowedQueue : public Sequence<T> {
+public:
+    using Value = typename Monoid::Value;
+
+private:
+    using SeqUPtr = typename Sequence<T>::SeqUPtr;
+
+    static constexpr bool kOrdered = std::totally_ordered<T>;
+    static constexpr bool kArithmetic = std::is_arithmetic_v<T>;
+
+    DequeArraySequence<T> items_;
+    DequeArraySequence<T> minQ_;            // неубывающая
+    DequeArraySequence<T> maxQ_;            // невозрастающая
+    T sum_{};
+    DequeArraySequence<Value> frontAgg_;    // frontAgg_.GetLast() — агрегат головы
+    Value backAgg_{Monoid::Identity()};
+    std::size_t window_{0};
+
+    template<typename M, typename... Args>
+    SeqUPtr cloneInvoke(M method, Args&&... args) const {
+        auto cp = Clone();
+        (static_cast<WindowedQueue*>(cp.get())->*method)(std::forward<Args>(args)...);
+        return cp;
+    }
+
+    void checkIndex(std::size_t i, const char* where) const {
+        if (i >= items_.GetLength()) throw std::out_of_range(where);
+    }
+
+    // p указывает на элемент окна (они лежат в items_ подряд)
+    bool aliases(const T* p) const {
+        std::size_t n = items_.GetLength();
+        if (n == 0) return false;
+        const T* b = &std::as_const(items_)[0];
+        std::less<const T*> lt;
+        return !lt(p, b) && lt(p, b + n);
+    }
+
+    // Учёт нового элемента в хвосте (сам элемент уже в items_)
+    void pushAggregates(const T& v) {
+        if constexpr (kOrdered) {
+            while (minQ_.GetLength() > 0 && v < minQ_.GetLast()) minQ_.PopBack();
+            minQ_.Append(v);
+            while (maxQ_.GetLength() > 0 && maxQ_.GetLast() < v) maxQ_.PopBack();
+            maxQ_.Append(v);
+        }
+        if constexpr (kArithmetic) sum_ += v;
+        backAgg_ = Monoid::Combine(backAgg_, Monoid::Lift(v));
+    }
+
+    // Хвост (items_ за головой) целиком переходит в голову
+    void transfer() {
+        std::size_t n = items_.GetLength();
+        Value acc = Monoid::Identity();
+        for (std::size_t i = n; i-- > 0; ) {
+            acc = Monoid::Combine(Monoid::Lift(items_[i]), acc);
+            frontAgg_.Append(acc);
+        }
+        backAgg_ = Monoid::Identity();
+    }
+
+    void rebuild() {
+        minQ_ = DequeArraySequence<T>();
+        maxQ_ = DequeArraySequence<T>();
+        frontAgg_ = DequeArraySequence<Value>();
+        sum_ = T{};
+        backAgg_ = Monoid::Identity();
+        for (std::size_t i = 0; i < items_.GetLength(); ++i)
+            pushAggregates(items_[i]);
+    }
+
+public:
+    // --- Конструкторы ---
+    WindowedQueue() = default;
+    explicit WindowedQueue(std::size_t window) : window_(window) {}
+
+    std::size_t GetWindow() const {
+        return window_;
+    }
+
+    // --- Очередь ---
+    void Enqueue(const T& v) {
+        T copy = v;   // v может быть элементом items_: вытеснение и рост буфера его затронут
+        if (window_ != 0 && items_.GetLength() == window_) Dequeue();
+        items_.Append(copy);
+        pushAggregates(copy);
+    }
+    void EnqueueRange(const T* items, std::size_t count) {
+        if (count && aliases(items)) {
+            DynamicArray<T> copy(items, count);
+            EnqueueRange(copy.Data(), count);
+            return;
+        }
+        for (std::size_t i = 0; i < count; ++i) Enqueue(items[i]);
+    }
+    T Dequeue() {
+        if (items_.GetLength() == 0)
+            throw std::out_of_range("WindowedQueue::Dequeue: пустая очередь");
+        if (frontAgg_.GetLength() == 0) transfer();
+        frontAgg_.PopBack();
+        T front = items_.PopFront();
+        if constexpr (kOrdered) {
+            if (!(minQ_.GetFirst() < front) && !(front < minQ_.GetFirst())) minQ_.PopFront();
+            if (!(maxQ_.GetFirst() < front) && !(front < maxQ_.GetFirst())) maxQ_.PopFront();
+        }
+        if constexpr (kArithmetic) sum_ -= front;
+        return front;
+    }
+    T Peek() const {
+        if (items_.GetLength() == 0)
+            throw std::out_of_range("WindowedQueue::Peek: пустая очередь");
+        return items_.GetFirst();
+    }
+
+    // --- Агрегаты окна, O(1) ---
+    Value Aggregate() const {
+        if (frontAgg_.GetLength() == 0) return backAgg_;
+        return Monoid::Combine(frontAgg_.GetLast(), backAgg_);
+    }
+    T GetMin() const requires std::totally_ordered<T> {
+        if (minQ_.GetLength() == 0)
+            throw std::out_of_range("WindowedQueue::GetMin: пустая очередь");
+        return minQ_.GetFirst();
+    }
+    T GetMax() const requires std::totally_ordered<T> {
+        if (maxQ_.GetLength() == 0)
+            throw std::out_of_range("WindowedQueue::GetMax: пустая очередь");
+        return maxQ_.GetFirst();
+    }
+    T GetSum() const requires std::is_arithmetic_v<T> {
+        return sum_;
+    }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return items_.GetLength();
+    }
+    T Get(std::size_t i) const override {
+        checkIndex(i, "WindowedQueue::Get: bad index");
+        return items_[i];
+    }
+    T GetFirst() const override {
+        checkIndex(0, "WindowedQueue::GetFirst: empty");
+        return items_.GetFirst();
+    }
+    T GetLast() const override {
+        checkIndex(0, "WindowedQueue::GetLast: empty");
+        return items_.GetLast();
+    }
+
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= items_.GetLength())
+            throw std::out_of_range("WindowedQueue::GetSubsequence: bad range");
+        auto out = std::make_unique<WindowedQueue>(window_);
+        for (std::size_t i = l; i <= r; ++i) out->Enqueue(items_[i]);
+        return out;
+    }
+
+    // --- Клонирование ---
+    SeqUPtr Clone() const override {
+        return std::make_unique<WindowedQueue>(*this);
+    }
+    Sequence<T>* Instance() override {
+        return new WindowedQueue(window_);
+    }
+
+    // --- Mutable API ---
+    void Append(const T& v) override {
+        Enqueue(v);
+    }
+    void AppendRange(const T* items, std::size_t count) override {
+        EnqueueRange(items, count);
+    }
+    void Prepend(const T& v) override {
+        InsertAt(v, 0);
+    }
+    void InsertAt(const T& v, std::size_t idx) override {
+        if (idx > items_.GetLength()) throw std::out_of_range("WindowedQueue::InsertAt: bad idx");
+        if (window_ != 0 && items_.GetLength() == window_) {
+            if (idx == 0) return;  // вставленный элемент сразу был бы вытеснен
+            T copy = v;            // v может быть вытесняемым элементом
+            items_.PopFront();
+            items_.InsertAt(copy, idx - 1);
+        } else {
+            items_.InsertAt(v, idx);
+        }
+        rebuild();
+    }
+    Sequence<T>* Concat(Sequence<T>* other) override {
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            Enqueue(other->Get(i));
+        return this;
+    }
+
+    // --- Immutable API ---
+    SeqUPtr Append(const T& v) const override {
+        return cloneInvoke(&WindowedQueue::Enqueue, v);
+    }
+    SeqUPtr Prepend(const T& v) const override {
+        return cloneInvoke(static_cast<void (WindowedQueue::*)(const T&)>(&WindowedQueue::Prepend), v);
+    }
+    SeqUPtr InsertAt(const T& v, std::size_t idx) const override {
+        return cloneInvoke(static_cast<void (WindowedQueue::*)(const T&, std::size_t)>(&WindowedQueue::InsertAt), v, idx);
+    }
+    SeqUPtr Concat(const Sequence<T>* other) const override {
+        auto cp = Clone();
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            static_cast<WindowedQueue*>(cp.get())->Enqueue(other->Get(i));
+        return cp;
+    }
+
+    // --- Операторы доступа ---
+    T& operator[](std::size_t) override {
+        throw std::logic_error("operator[] не поддерживается в WindowedQueue");
+    }
+    const T& operator[](std::size_t i) const override {
+        checkIndex(i, "WindowedQueue::operator[] const: bad index");
+        return items_[i];
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, T& out) const override {
+        return items_.TryGet(i, out);
+    }
+    bool TryGetFirst(T& out) const override {
+        return items_.TryGetFirst(out);
+    }
+    bool TryGetLast(T& out) const override {
+        return items_.TryGetLast(out);
+    }
+    bool TryFind(std::function<bool(const T&)> pred, T& out) const override {
+        return items_.TryFind(pred, out);
+    }
+};
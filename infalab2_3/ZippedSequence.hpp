@@ -0,0 +1,341 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "MutableArraySequence.hpp"
+#include "DynamicArray.hpp"
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+// Представление пары последовательностей как Sequence<std::pair<A,B>> без копирования.
+// Источники не копируются и должны жить дольше представления; длина — min из двух
+// (фиксируется при создании). Мутирующие методы запрещены, immutable-версии
+// материализуют результат в MutableArraySequence.
+// Пары в памяти нет, поэтому operator[] запрещён в обеих версиях — чтение через Get.
+template<typename A, typename B>
+class ZippedSequence : public Sequence<std::pair<A, B>> {
+private:
+    using P = std::pair<A, B>;
+    using SeqUPtr = typename Sequence<P>::SeqUPtr;
+
+    const Sequence<A>* a_;
+    const Sequence<B>* b_;
+    std::size_t offset_;
+    std::size_t length_;
+
+    P at(std::size_t i) const {
+        return P(a_->Get(offset_ + i), b_->Get(offset_ + i));
+    }
+    void checkIndex(std::size_t i, const char* where) const {
+        if (i >= length_) throw std::out_of_range(where);
+    }
+    std::unique_ptr<MutableArraySequence<P>> materialize() const {
+        DynamicArray<P> buf(length_);
+        for (std::size_t i = 0; i < length_; ++i) buf[i] = at(i);
+        return std::make_unique<MutableArraySequence<P>>(std::move(buf));
+    }
+
+public:
+    ZippedSequence(const Sequence<A>& a, const Sequence<B>& b)
+      : a_(&a), b_(&b), offset_(0),
+        length_(a.GetLength() < b.GetLength() ? a.GetLength() : b.GetLength()) {}
+    ZippedSequence(const Sequence<A>& a, const Sequence<B>& b, std::size_t offset, std::size_t length)
+      : a_(&a), b_(&b), offset_(offset), length_(length) {}
+
+    // --- Источники (целиком, без учёта смещения подпредставления) ---
+    const Sequence<A>& Firsts() const { return *a_; }
+    const Sequence<B>& Seconds() const { return *b_; }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return length_;
+    }
+    P Get(std::size_t i) const override {
+        checkIndex(i, "ZippedSequence::Get: bad index");
+        return at(i);
+    }
+    P GetFirst() const override {
+        checkIndex(0, "ZippedSequence::GetFirst: empty");
+        return at(0);
+    }
+    P GetLast() const override {
+        checkIndex(0, "ZippedSequence::GetLast: empty");
+        return at(length_ - 1);
+    }
+
+    // Подпоследовательность — тоже представление над теми же источниками
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= length_)
+            throw std::out_of_range("ZippedSequence::GetSubsequence: bad range");
+        return std::make_unique<ZippedSequence<A, B>>(*a_, *b_, offset_ + l, r - l + 1);
+    }
+
+    // --- Клонирование: копируется само представление ---
+    SeqUPtr Clone() const override {
+        return std::make_unique<ZippedSequence<A, B>>(*a_, *b_, offset_, length_);
+    }
+    Sequence<P>* Instance() override {
+        return new MutableArraySequence<P>();
+    }
+
+    // --- Mutable API недоступен ---
+    void Append(const P&) override {
+        throw std::logic_error("ZippedSequence: read-only view");
+    }
+    void Prepend(const P&) override {
+        throw std::logic_error("ZippedSequence: read-only view");
+    }
+    void InsertAt(const P&, std::size_t) override {
+        throw std::logic_error("ZippedSequence: read-only view");
+    }
+    Sequence<P>* Concat(Sequence<P>*) override {
+        throw std::logic_error("ZippedSequence: read-only view");
+    }
+
+    // --- Immutable API ---
+    SeqUPtr Append(const P& v) const override {
+        auto out = materialize();
+        out->Append(v);
+        return out;
+    }
+    SeqUPtr Prepend(const P& v) const override {
+        auto out = materialize();
+        out->Prepend(v);
+        return out;
+    }
+    SeqUPtr InsertAt(const P& v, std::size_t idx) const override {
+        auto out = materialize();
+        out->InsertAt(v, idx);
+        return out;
+    }
+    SeqUPtr Concat(const Sequence<P>* other) const override {
+        auto out = materialize();
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            out->Append(other->Get(i));
+        return out;
+    }
+
+    // --- Операторы доступа ---
+    P& operator[](std::size_t) override {
+        throw std::logic_error("ZippedSequence: read-only view");
+    }
+    const P& operator[](std::size_t) const override {
+        throw std::logic_error("ZippedSequence: read-only view, use Get");
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, P& out) const override {
+        if (i >= length_) return false;
+        out = at(i);
+        return true;
+    }
+    bool TryGetFirst(P& out) const override {
+        return TryGet(0, out);
+    }
+    bool TryGetLast(P& out) const override {
+        if (length_ == 0) return false;
+        return TryGet(length_ - 1, out);
+    }
+    bool TryFind(std::function<bool(const P&)> pred, P& out) const override {
+        for (std::size_t i = 0; i < length_; ++i) {
+            P v = at(i);
+            if (pred(v)) {
+                out = std::move(v);
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// Последовательность пар в раздельном хранении (structure of arrays): первые и
+// вторые элементы лежат в своих непрерывных массивах. Firsts()/Seconds() отдают
+// столбцы без копирования, поэтому проход по одному полю не читает другое.
+// Запись по ссылке — через First(i)/Second(i) или Set, чтение — через Get;
+// operator[] запрещён в обеих версиях, так как целой пары в памяти нет.
+template<typename A, typename B>
+class PairSequence : public Sequence<std::pair<A, B>> {
+private:
+    using P = std::pair<A, B>;
+    using SeqUPtr = typename Sequence<P>::SeqUPtr;
+
+    MutableArraySequence<A> firsts_;
+    MutableArraySequence<B> seconds_;
+
+    template<typename M, typename... Args>
+    SeqUPtr cloneInvoke(M method, Args&&... args) const {
+        auto cp = Clone();
+        (static_cast<PairSequence<A, B>*>(cp.get())->*method)(std::forward<Args>(args)...);
+        return cp;
+    }
+
+    P at(std::size_t i) const {
+        return P(firsts_[i], seconds_[i]);
+    }
+    void checkIndex(std::size_t i, const char* where) const {
+        if (i >= GetLength()) throw std::out_of_range(where);
+    }
+
+    // Заполняет оба столбца за один проход: get(i) возвращает пару
+    template<typename Get>
+    void fill(std::size_t n, Get get) {
+        DynamicArray<A> fa(n);
+        DynamicArray<B> fb(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            P p = get(i);
+            fa[i] = std::move(p.first);
+            fb[i] = std::move(p.second);
+        }
+        firsts_ = MutableArraySequence<A>(std::move(fa));
+        seconds_ = MutableArraySequence<B>(std::move(fb));
+    }
+
+public:
+    // --- Конструкторы ---
+    PairSequence() = default;
+
+    // Столбцы из двух последовательностей (длина — min из двух)
+    PairSequence(const Sequence<A>& a, const Sequence<B>& b) {
+        std::size_t n = a.GetLength() < b.GetLength() ? a.GetLength() : b.GetLength();
+        fill(n, [&](std::size_t i) { return P(a.Get(i), b.Get(i)); });
+    }
+
+    explicit PairSequence(const Sequence<P>& src) {
+        fill(src.GetLength(), [&](std::size_t i) { return src.Get(i); });
+    }
+
+    // --- Столбцы ---
+    const MutableArraySequence<A>& Firsts() const { return firsts_; }
+    const MutableArraySequence<B>& Seconds() const { return seconds_; }
+
+    A& First(std::size_t i) {
+        checkIndex(i, "PairSequence::First: bad index");
+        return firsts_[i];
+    }
+    B& Second(std::size_t i) {
+        checkIndex(i, "PairSequence::Second: bad index");
+        return seconds_[i];
+    }
+    void Set(std::size_t i, const P& v) {
+        checkIndex(i, "PairSequence::Set: bad index");
+        firsts_[i] = v.first;
+        seconds_[i] = v.second;
+    }
+
+    // --- Методы чтения ---
+    std::size_t GetLength() const override {
+        return firsts_.GetLength();
+    }
+    P Get(std::size_t i) const override {
+        checkIndex(i, "PairSequence::Get: bad index");
+        return at(i);
+    }
+    P GetFirst() const override {
+        checkIndex(0, "PairSequence::GetFirst: empty");
+        return at(0);
+    }
+    P GetLast() const override {
+        checkIndex(0, "PairSequence::GetLast: empty");
+        return at(GetLength() - 1);
+    }
+
+    SeqUPtr GetSubsequence(std::size_t l, std::size_t r) const override {
+        if (l > r || r >= GetLength())
+            throw std::out_of_range("PairSequence::GetSubsequence: bad range");
+        auto out = std::make_unique<PairSequence<A, B>>();
+        out->fill(r - l + 1, [&](std::size_t i) { return at(l + i); });
+        return out;
+    }
+
+    // --- Клонирование ---
+    SeqUPtr Clone() const override {
+        return std::make_unique<PairSequence<A, B>>(*this);
+    }
+    Sequence<P>* Instance() override {
+        return new PairSequence<A, B>();
+    }
+
+    // --- Mutable API ---
+    void Append(const P& v) override {
+        firsts_.Append(v.first);
+        seconds_.Append(v.second);
+    }
+    void Prepend(const P& v) override {
+        firsts_.Prepend(v.first);
+        seconds_.Prepend(v.second);
+    }
+    void InsertAt(const P& v, std::size_t idx) override {
+        if (idx > GetLength()) throw std::out_of_range("PairSequence::InsertAt: bad idx");
+        firsts_.InsertAt(v.first, idx);
+        seconds_.InsertAt(v.second, idx);
+    }
+    Sequence<P>* Concat(Sequence<P>* other) override {
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            Append(other->Get(i));
+        return this;
+    }
+
+    // --- Immutable API ---
+    SeqUPtr Append(const P& v) const override {
+        return cloneInvoke(static_cast<void (PairSequence::*)(const P&)>(&PairSequence::Append), v);
+    }
+    SeqUPtr Prepend(const P& v) const override {
+        return cloneInvoke(static_cast<void (PairSequence::*)(const P&)>(&PairSequence::Prepend), v);
+    }
+    SeqUPtr InsertAt(const P& v, std::size_t idx) const override {
+        return cloneInvoke(static_cast<void (PairSequence::*)(const P&, std::size_t)>(&PairSequence::InsertAt), v, idx);
+    }
+    SeqUPtr Concat(const Sequence<P>* other) const override {
+        auto cp = Clone();
+        for (std::size_t i = 0; i < other->GetLength(); ++i)
+            static_cast<PairSequence<A, B>*>(cp.get())->Append(other->Get(i));
+        return cp;
+    }
+
+    // --- Операторы доступа ---
+    P& operator[](std::size_t) override {
+        throw std::logic_error("PairSequence::operator[]: use First/Second/Set");
+    }
+    const P& operator[](std::size_t) const override {
+        throw std::logic_error("PairSequence::operator[] const: use Get");
+    }
+
+    // --- Try-версии ---
+    bool TryGet(std::size_t i, P& out) const override {
+        if (i >= GetLength()) return false;
+        out = at(i);
+        return true;
+    }
+    bool TryGetFirst(P& out) const override {
+        return TryGet(0, out);
+    }
+    bool TryGetLast(P& out) const override {
+        std::size_t n = GetLength();
+        if (n == 0) return false;
+        return TryGet(n - 1, out);
+    }
+    bool TryFind(std::function<bool(const P&)> pred, P& out) const override {
+        std::size_t n = GetLength();
+        for (std::size_t i = 0; i < n; ++i) {
+            P v = at(i);
+            if (pred(v)) {
+                out = std::move(v);
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// Zip без копирования
+template<typename A, typename B>
+ZippedSequence<A, B> ZipView(const Sequence<A>& a, const Sequence<B>& b) {
+    return ZippedSequence<A, B>(a, b);
+}
+
+// Unzip без копирования: столбцы PairSequence
+template<typename A, typename B>
+std::pair<const Sequence<A>&, const Sequence<B>&> UnzipView(const PairSequence<A, B>& src) {
+    return {src.Firsts(), src.Seconds()};
+}
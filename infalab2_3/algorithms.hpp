@@ -1,11 +1,17 @@
 #pragma once
 
 #include "Sequence.hpp"
+#include "DynamicArray.hpp"
 #include "MutableArraySequence.hpp"
+#include "FixedArraySequence.hpp"
 #include <functional>
 #include <memory>
 #include <utility>
 #include <algorithm>
+#include <concepts>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
 
 template<typename T, typename U>
 typename Sequence<U>::SeqUPtr Map(
@@ -13,9 +19,7 @@ typename Sequence<U>::SeqUPtr Map(
     std::function<U(const T&)> f)
 {
     auto out = std::make_unique<MutableArraySequence<U>>();
-    std::size_t n = src.GetLength();
-    for (std::size_t i = 0; i < n; ++i)
-        out->Append(f(src.Get(i)));
+    src.ForEach([&](const T& v) { out->Append(f(v)); });
     return out;
 }
 
@@ -25,13 +29,10 @@ typename Sequence<U>::SeqUPtr FlatMap(
     std::function<typename Sequence<U>::SeqUPtr(const T&)> f)
 {
     auto out = std::make_unique<MutableArraySequence<U>>();
-    std::size_t n = src.GetLength();
-    for (std::size_t i = 0; i < n; ++i) {
-        auto part = f(src.Get(i));
-        std::size_t m = part->GetLength();
-        for (std::size_t j = 0; j < m; ++j)
-            out->Append(part->Get(j));
-    }
+    src.ForEach([&](const T& v) {
+        auto part = f(v);
+        part->ForEach([&](const U& u) { out->Append(u); });
+    });
     return out;
 }
 
@@ -41,11 +42,9 @@ typename Sequence<T>::SeqUPtr Where(
     std::function<bool(const T&)> pred)
 {
     auto out = std::make_unique<MutableArraySequence<T>>();
-    std::size_t n = src.GetLength();
-    for (std::size_t i = 0; i < n; ++i) {
-        const T& v = src.Get(i);
+    src.ForEach([&](const T& v) {
         if (pred(v)) out->Append(v);
-    }
+    });
     return out;
 }
 
@@ -56,9 +55,7 @@ U Reduce(
     std::function<U(const U&, const T&)> f)
 {
     U acc = init;
-    std::size_t n = src.GetLength();
-    for (std::size_t i = 0; i < n; ++i)
-        acc = f(acc, src.Get(i));
+    src.ForEach([&](const T& v) { acc = f(acc, v); });
     return acc;
 }
 
@@ -178,3 +175,435 @@ typename Sequence<T>::SeqUPtr Slice(
         out->Append(src.Get(i));
     return out;
 }
+
+// --- constexpr-перегрузки для FixedArraySequence ---
+// Результат — тоже FixedArraySequence с ёмкостью, выведенной из входов;
+// вызывающий код прежний: Map<int,int>(fixed, f), Where<int>(fixed, p) и т.д.
+
+template<typename T, typename U, std::size_t N, typename F>
+constexpr FixedArraySequence<U, N> Map(
+    const FixedArraySequence<T, N>& src,
+    F f)
+{
+    FixedArraySequence<U, N> out;
+    for (const T& v : src) out.Append(f(v));
+    return out;
+}
+
+// f возвращает FixedArraySequence<U, M>
+template<typename T, typename U, std::size_t N, typename F>
+constexpr auto FlatMap(
+    const FixedArraySequence<T, N>& src,
+    F f)
+{
+    using Part = decltype(f(src[0]));
+    FixedArraySequence<U, N * Part::Capacity()> out;
+    for (const T& v : src) {
+        auto part = f(v);
+        for (const U& u : part) out.Append(u);
+    }
+    return out;
+}
+
+template<typename T, std::size_t N, typename Pred>
+constexpr FixedArraySequence<T, N> Where(
+    const FixedArraySequence<T, N>& src,
+    Pred pred)
+{
+    FixedArraySequence<T, N> out;
+    for (const T& v : src)
+        if (pred(v)) out.Append(v);
+    return out;
+}
+
+template<typename T, typename U, std::size_t N, typename F>
+constexpr U Reduce(
+    const FixedArraySequence<T, N>& src,
+    U init,
+    F f)
+{
+    U acc = init;
+    for (const T& v : src) acc = f(acc, v);
+    return acc;
+}
+
+template<typename T, std::size_t N, typename Pred>
+constexpr T Find(
+    const FixedArraySequence<T, N>& src,
+    Pred pred)
+{
+    for (const T& v : src)
+        if (pred(v)) return v;
+    throw std::runtime_error("Find: no matching element");
+}
+
+template<typename T, std::size_t N, typename Pred>
+constexpr bool TryFind(
+    const FixedArraySequence<T, N>& src,
+    Pred pred,
+    T& out)
+{
+    return src.TryFind(pred, out);
+}
+
+template<typename T, std::size_t N, std::size_t M>
+constexpr bool ContainsSubsequence(
+    const FixedArraySequence<T, N>& src,
+    const FixedArraySequence<T, M>& pat)
+{
+    std::size_t n = src.GetLength(), m = pat.GetLength();
+    if (m == 0) return true;
+    for (std::size_t i = 0; i + m <= n; ++i) {
+        bool ok = true;
+        for (std::size_t j = 0; j < m; ++j) {
+            if (src[i + j] != pat[j]) { ok = false; break; }
+        }
+        if (ok) return true;
+    }
+    return false;
+}
+
+template<typename A, typename B, std::size_t N, std::size_t M>
+constexpr FixedArraySequence<std::pair<A,B>, (N < M ? N : M)> Zip(
+    const FixedArraySequence<A, N>& a,
+    const FixedArraySequence<B, M>& b)
+{
+    FixedArraySequence<std::pair<A,B>, (N < M ? N : M)> out;
+    std::size_t n = std::min(a.GetLength(), b.GetLength());
+    for (std::size_t i = 0; i < n; ++i)
+        out.Append({a[i], b[i]});
+    return out;
+}
+
+template<typename A, typename B, std::size_t N>
+constexpr std::pair<FixedArraySequence<A, N>, FixedArraySequence<B, N>> Unzip(
+    const FixedArraySequence<std::pair<A,B>, N>& src)
+{
+    std::pair<FixedArraySequence<A, N>, FixedArraySequence<B, N>> out;
+    for (const auto& p : src) {
+        out.first.Append(p.first);
+        out.second.Append(p.second);
+    }
+    return out;
+}
+
+template<typename T, std::size_t N, typename Pred>
+constexpr FixedArraySequence<FixedArraySequence<T, N>, N + 1> Split(
+    const FixedArraySequence<T, N>& src,
+    Pred delim)
+{
+    FixedArraySequence<FixedArraySequence<T, N>, N + 1> out;
+    FixedArraySequence<T, N> cur;
+    for (const T& v : src) {
+        if (delim(v)) {
+            out.Append(cur);
+            cur.Clear();
+        } else {
+            cur.Append(v);
+        }
+    }
+    out.Append(cur);
+    return out;
+}
+
+template<typename T, std::size_t N>
+constexpr FixedArraySequence<T, N> Slice(
+    const FixedArraySequence<T, N>& src,
+    int index,
+    std::size_t cnt)
+{
+    int n = static_cast<int>(src.GetLength());
+    if (index < 0) index += n;
+    if (index < 0 || index > n)
+        throw std::out_of_range("Slice: bad index");
+    FixedArraySequence<T, N> out;
+    for (int i = 0; i < index; ++i)
+        out.Append(src[i]);
+    for (int i = index + static_cast<int>(cnt); i < n; ++i)
+        out.Append(src[i]);
+    return out;
+}
+
+template<typename T, std::size_t N, std::size_t M>
+constexpr FixedArraySequence<T, N + M> Slice(
+    const FixedArraySequence<T, N>& src,
+    int index,
+    std::size_t cnt,
+    const FixedArraySequence<T, M>& insert)
+{
+    int n = static_cast<int>(src.GetLength());
+    if (index < 0) index += n;
+    if (index < 0 || index > n)
+        throw std::out_of_range("Slice: bad index");
+    FixedArraySequence<T, N + M> out;
+    for (int i = 0; i < index; ++i)
+        out.Append(src[i]);
+    out.Concat(insert);
+    for (int i = index + static_cast<int>(cnt); i < n; ++i)
+        out.Append(src[i]);
+    return out;
+}
+
+// --- Статическая диспетчеризация для конкретных контейнеров ---
+// Перегрузки для массивов (MutableArraySequence, ImmutableArraySequence,
+// DynamicArray), списков (MutableListSequence, ImmutableListSequence) и любых
+// непрерывных диапазонов (C-массив, std::span) с произвольным вызываемым
+// объектом: цикл идёт по указателю или по узлам списка, без виртуальных Get
+// и без std::function, так что f встраивается, а цикл по массиву векторизуется.
+// Вызываются без явных шаблонных аргументов: Map(arr, f), Reduce(list, 0, f).
+// Результат — конкретный MutableArraySequence по значению.
+// Функции с const Sequence<T>& остаются для вызовов через базовый класс.
+
+namespace algo_detail {
+
+template<typename C> struct IsFixed : std::false_type {};
+template<typename T, std::size_t N> struct IsFixed<FixedArraySequence<T, N>> : std::true_type {};
+
+template<typename C>
+concept StorageBacked = requires(const C& c) {
+    { c.GetStorage().Data() } -> std::convertible_to<const void*>;
+    { c.GetLength() } -> std::convertible_to<std::size_t>;
+};
+
+template<typename C>
+concept BufferBacked = requires(const C& c) {
+    { c.Data() } -> std::convertible_to<const void*>;
+    { c.GetSize() } -> std::convertible_to<std::size_t>;
+};
+
+template<typename C>
+concept ListBacked = requires(const C& c) {
+    c.GetList().begin();
+};
+
+// Блочные контейнеры (SegmentedArraySequence): курсор сам переходит между блоками
+template<typename C>
+concept CursorBacked = requires(const C& c) {
+    *c.Cursor();
+    { c.GetLength() } -> std::convertible_to<std::size_t>;
+};
+
+template<typename C>
+concept RangeBacked = std::ranges::contiguous_range<const C> && std::ranges::sized_range<const C>;
+
+template<typename C>
+auto cursor(const C& c) {
+    if constexpr (StorageBacked<C>)     return c.GetStorage().Data();
+    else if constexpr (BufferBacked<C>) return c.Data();
+    else if constexpr (RangeBacked<C>)  return std::ranges::data(c);
+    else if constexpr (CursorBacked<C>) return c.Cursor();
+    else return c.GetList().begin();  // итератор по узлам: *it, ++it — как у указателя
+}
+
+template<typename C>
+std::size_t length(const C& c) {
+    if constexpr (StorageBacked<C>)     return c.GetLength();
+    else if constexpr (BufferBacked<C>) return c.GetSize();
+    else if constexpr (RangeBacked<C>)  return std::ranges::size(c);
+    else if constexpr (CursorBacked<C>) return c.GetLength();
+    else return c.GetList().GetLength();
+}
+
+// Дописывание в буфер с удвоением; размер буфера приводится к k в конце (finish)
+template<typename T, typename V>
+void push(DynamicArray<T>& buf, std::size_t& k, V&& v) {
+    if (k == buf.GetSize()) buf.Resize(k ? 2 * k : 8);
+    buf.Data()[k++] = std::forward<V>(v);
+}
+
+template<typename T>
+MutableArraySequence<T> finish(DynamicArray<T>& buf, std::size_t k) {
+    buf.Resize(k);
+    return MutableArraySequence<T>(std::move(buf));
+}
+
+}  // namespace algo_detail
+
+template<typename C>
+concept StaticSequence =
+    !std::is_abstract_v<C> && !algo_detail::IsFixed<C>::value &&
+    (algo_detail::StorageBacked<C> || algo_detail::BufferBacked<C> ||
+     algo_detail::RangeBacked<C> || algo_detail::CursorBacked<C> || algo_detail::ListBacked<C>);
+
+template<StaticSequence C>
+using ElementOf = std::remove_cvref_t<decltype(*algo_detail::cursor(std::declval<const C&>()))>;
+
+template<StaticSequence C, typename F>
+auto Map(const C& src, F f)
+{
+    using U = std::remove_cvref_t<std::invoke_result_t<F&, const ElementOf<C>&>>;
+    std::size_t n = algo_detail::length(src);
+    DynamicArray<U> out(n);
+    U* dst = out.Data();
+    auto it = algo_detail::cursor(src);
+    for (std::size_t i = 0; i < n; ++i, ++it)
+        dst[i] = f(*it);
+    return MutableArraySequence<U>(std::move(out));
+}
+
+// f возвращает любой контейнер, подходящий под StaticSequence
+template<StaticSequence C, typename F>
+auto FlatMap(const C& src, F f)
+{
+    using Part = std::remove_cvref_t<std::invoke_result_t<F&, const ElementOf<C>&>>;
+    using U = ElementOf<Part>;
+    DynamicArray<U> out;
+    std::size_t k = 0;
+    std::size_t n = algo_detail::length(src);
+    auto it = algo_detail::cursor(src);
+    for (std::size_t i = 0; i < n; ++i, ++it) {
+        Part part = f(*it);
+        std::size_t m = algo_detail::length(part);
+        auto pit = algo_detail::cursor(part);
+        for (std::size_t j = 0; j < m; ++j, ++pit)
+            algo_detail::push(out, k, *pit);
+    }
+    return algo_detail::finish(out, k);
+}
+
+template<StaticSequence C, typename Pred>
+auto Where(const C& src, Pred pred)
+{
+    using T = ElementOf<C>;
+    std::size_t n = algo_detail::length(src);
+    DynamicArray<T> out(n);
+    T* dst = out.Data();
+    std::size_t k = 0;
+    auto it = algo_detail::cursor(src);
+    for (std::size_t i = 0; i < n; ++i, ++it)
+        if (pred(*it)) dst[k++] = *it;
+    return algo_detail::finish(out, k);
+}
+
+template<StaticSequence C, typename U, typename F>
+U Reduce(const C& src, U init, F f)
+{
+    U acc = init;
+    std::size_t n = algo_detail::length(src);
+    auto it = algo_detail::cursor(src);
+    for (std::size_t i = 0; i < n; ++i, ++it)
+        acc = f(acc, *it);
+    return acc;
+}
+
+template<StaticSequence C, typename Pred>
+bool TryFind(const C& src, Pred pred, ElementOf<C>& out)
+{
+    std::size_t n = algo_detail::length(src);
+    auto it = algo_detail::cursor(src);
+    for (std::size_t i = 0; i < n; ++i, ++it) {
+        if (pred(*it)) { out = *it; return true; }
+    }
+    return false;
+}
+
+template<StaticSequence C, typename Pred>
+ElementOf<C> Find(const C& src, Pred pred)
+{
+    ElementOf<C> out;
+    if (!TryFind(src, pred, out))
+        throw std::runtime_error("Find: no matching element");
+    return out;
+}
+
+template<StaticSequence C, StaticSequence P>
+bool ContainsSubsequence(const C& src, const P& pat)
+{
+    std::size_t n = algo_detail::length(src), m = algo_detail::length(pat);
+    if (m == 0) return true;
+    auto start = algo_detail::cursor(src);
+    for (std::size_t i = 0; i + m <= n; ++i, ++start) {
+        auto s = start;
+        auto p = algo_detail::cursor(pat);
+        std::size_t j = 0;
+        for (; j < m && *s == *p; ++j, ++s, ++p) {}
+        if (j == m) return true;
+    }
+    return false;
+}
+
+template<StaticSequence A, StaticSequence B>
+auto Zip(const A& a, const B& b)
+{
+    using P = std::pair<ElementOf<A>, ElementOf<B>>;
+    std::size_t n = std::min(algo_detail::length(a), algo_detail::length(b));
+    DynamicArray<P> out(n);
+    P* dst = out.Data();
+    auto ia = algo_detail::cursor(a);
+    auto ib = algo_detail::cursor(b);
+    for (std::size_t i = 0; i < n; ++i, ++ia, ++ib)
+        dst[i] = P(*ia, *ib);
+    return MutableArraySequence<P>(std::move(out));
+}
+
+template<StaticSequence C>
+    requires requires { typename ElementOf<C>::first_type; typename ElementOf<C>::second_type; }
+auto Unzip(const C& src)
+{
+    using A = typename ElementOf<C>::first_type;
+    using B = typename ElementOf<C>::second_type;
+    std::size_t n = algo_detail::length(src);
+    DynamicArray<A> ua(n);
+    DynamicArray<B> ub(n);
+    auto it = algo_detail::cursor(src);
+    for (std::size_t i = 0; i < n; ++i, ++it) {
+        ua.Data()[i] = (*it).first;
+        ub.Data()[i] = (*it).second;
+    }
+    return std::pair<MutableArraySequence<A>, MutableArraySequence<B>>(
+        MutableArraySequence<A>(std::move(ua)), MutableArraySequence<B>(std::move(ub)));
+}
+
+// Части владеют своими элементами (в отличие от Split по Sequence<T>, отдающего сырые указатели)
+template<StaticSequence C, typename Pred>
+auto Split(const C& src, Pred delim)
+{
+    using T = ElementOf<C>;
+    DynamicArray<MutableArraySequence<T>> parts;
+    std::size_t np = 0;
+    DynamicArray<T> cur;
+    std::size_t k = 0;
+    std::size_t n = algo_detail::length(src);
+    auto it = algo_detail::cursor(src);
+    for (std::size_t i = 0; i < n; ++i, ++it) {
+        if (delim(*it)) {
+            algo_detail::push(parts, np, algo_detail::finish(cur, k));
+            cur = DynamicArray<T>();
+            k = 0;
+        } else {
+            algo_detail::push(cur, k, *it);
+        }
+    }
+    algo_detail::push(parts, np, algo_detail::finish(cur, k));
+    return algo_detail::finish(parts, np);
+}
+
+template<StaticSequence C, StaticSequence I>
+auto Slice(const C& src, int index, std::size_t cnt, const I& insert)
+{
+    using T = ElementOf<C>;
+    int n = static_cast<int>(algo_detail::length(src));
+    if (index < 0) index += n;
+    if (index < 0 || index > n)
+        throw std::out_of_range("Slice: bad index");
+    std::size_t tailFrom = std::min<std::size_t>(n, index + cnt);
+    std::size_t m = algo_detail::length(insert);
+    DynamicArray<T> out(index + m + (n - tailFrom));
+    T* dst = out.Data();
+    auto it = algo_detail::cursor(src);
+    for (int i = 0; i < index; ++i, ++it)
+        *dst++ = *it;
+    auto ins = algo_detail::cursor(insert);
+    for (std::size_t j = 0; j < m; ++j, ++ins)
+        *dst++ = *ins;
+    for (std::size_t i = index; i < tailFrom; ++i) ++it;
+    for (std::size_t i = tailFrom; i < static_cast<std::size_t>(n); ++i, ++it)
+        *dst++ = *it;
+    return MutableArraySequence<T>(std::move(out));
+}
+
+template<StaticSequence C>
+auto Slice(const C& src, int index, std::size_t cnt)
+{
+    return Slice(src, index, cnt, DynamicArray<ElementOf<C>>());
+}
@@ -0,0 +1,249 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "MutableArraySequence.hpp"
+#include "OpenHashMap.hpp"
+#include "TaskScheduler.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+// Множественные и группирующие операции на хеш-таблице OpenHashMap.
+// Таблицы резервируются по GetLength() входа, так что перехеширования нет;
+// всё — O(n + m) в среднем. Результаты сохраняют порядок входа:
+// Distinct/Intersect/Except — порядок первых вхождений, группы — порядок элементов.
+
+// Группы: ключ -> элементы с этим ключом
+template<typename K, typename T>
+using Groups = OpenHashMap<K, MutableArraySequence<T>>;
+
+namespace grouping_detail {
+
+// Номер части для ParallelGroupBy: старшие биты фибоначчиева хеширования,
+// чтобы не совпадать с младшими битами, по которым раскладывает OpenHashMap
+template<typename K>
+std::size_t partOf(const K& key, std::size_t parts) {
+    std::uint64_t h = static_cast<std::uint64_t>(std::hash<K>{}(key)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<std::size_t>((h >> 32) % parts);
+}
+
+// Цепочка позиций с одним ключом, связанная через массив next (как в HashIndex)
+inline constexpr std::size_t npos = static_cast<std::size_t>(-1);
+struct Chain {
+    std::size_t first{npos};
+    std::size_t last{npos};
+};
+
+}  // namespace grouping_detail
+
+template<typename T>
+typename Sequence<T>::SeqUPtr Distinct(const Sequence<T>& src)
+{
+    auto out = std::make_unique<MutableArraySequence<T>>();
+    OpenHashMap<T, char> seen(src.GetLength());
+    src.ForEach([&](const T& v) {
+        if (seen.Insert(v, 1)) out->Append(v);
+    });
+    return out;
+}
+
+template<typename T, typename K>
+Groups<K, T> GroupBy(
+    const Sequence<T>& src,
+    std::function<K(const T&)> key)
+{
+    Groups<K, T> groups(src.GetLength());
+    src.ForEach([&](const T& v) {
+        groups[key(v)].Append(v);
+    });
+    return groups;
+}
+
+template<typename T, typename K>
+OpenHashMap<K, std::size_t> CountBy(
+    const Sequence<T>& src,
+    std::function<K(const T&)> key)
+{
+    OpenHashMap<K, std::size_t> counts(src.GetLength());
+    src.ForEach([&](const T& v) {
+        ++counts[key(v)];
+    });
+    return counts;
+}
+
+// Различные элементы a, которые есть в b
+template<typename T>
+typename Sequence<T>::SeqUPtr Intersect(
+    const Sequence<T>& a,
+    const Sequence<T>& b)
+{
+    OpenHashMap<T, char> inB(b.GetLength());
+    b.ForEach([&](const T& v) { inB.Insert(v, 1); });
+    auto out = std::make_unique<MutableArraySequence<T>>();
+    a.ForEach([&](const T& v) {
+        char* mark = inB.Find(v);
+        if (mark && *mark == 1) {
+            *mark = 2;  // уже выдан
+            out->Append(v);
+        }
+    });
+    return out;
+}
+
+// Различные элементы a, которых нет в b
+template<typename T>
+typename Sequence<T>::SeqUPtr Except(
+    const Sequence<T>& a,
+    const Sequence<T>& b)
+{
+    OpenHashMap<T, char> seen(a.GetLength() + b.GetLength());
+    b.ForEach([&](const T& v) { seen.Insert(v, 1); });
+    auto out = std::make_unique<MutableArraySequence<T>>();
+    a.ForEach([&](const T& v) {
+        if (seen.Insert(v, 1)) out->Append(v);
+    });
+    return out;
+}
+
+// Внутреннее хеш-соединение: таблица строится по b, a просматривается.
+// Пары идут в порядке a, для одного элемента a — в порядке b.
+template<typename A, typename B, typename K, typename R>
+typename Sequence<R>::SeqUPtr Join(
+    const Sequence<A>& a,
+    const Sequence<B>& b,
+    std::function<K(const A&)> keyA,
+    std::function<K(const B&)> keyB,
+    std::function<R(const A&, const B&)> combine)
+{
+    using grouping_detail::npos;
+    using Chain = grouping_detail::Chain;
+
+    std::size_t m = b.GetLength();
+    DynamicArray<B> rows(m);
+    DynamicArray<std::size_t> next(m);
+    OpenHashMap<K, Chain> index(m);
+    std::size_t pos = 0;
+    b.ForEach([&](const B& v) {
+        rows[pos] = v;
+        next[pos] = npos;
+        Chain& c = index[keyB(v)];
+        if (c.first == npos) c.first = pos;
+        else                 next[c.last] = pos;
+        c.last = pos;
+        ++pos;
+    });
+
+    auto out = std::make_unique<MutableArraySequence<R>>();
+    a.ForEach([&](const A& v) {
+        const Chain* c = index.Find(keyA(v));
+        if (!c) return;
+        for (std::size_t p = c->first; p != npos; p = next[p])
+            out->Append(combine(v, rows[p]));
+    });
+    return out;
+}
+
+template<typename A, typename B, typename K>
+typename Sequence<std::pair<A,B>>::SeqUPtr Join(
+    const Sequence<A>& a,
+    const Sequence<B>& b,
+    std::function<K(const A&)> keyA,
+    std::function<K(const B&)> keyB)
+{
+    return Join<A, B, K, std::pair<A,B>>(a, b, keyA, keyB,
+        [](const A& x, const B& y) { return std::pair<A,B>(x, y); });
+}
+
+// Параллельная GroupBy для больших массивов (нужен Get за O(1)):
+//  1) по кускам входа параллельно считаются ключи и номера частей;
+//  2) устойчивая раскладка позиций по частям (подсчёт + префиксные суммы);
+//  3) каждая часть группируется в своей таблице параллельно;
+//  4) группы частей (ключи в них не пересекаются) переносятся в общую таблицу.
+// Порядок элементов в группах — как во входе.
+template<typename T, typename K>
+Groups<K, T> ParallelGroupBy(
+    const Sequence<T>& src,
+    std::function<K(const T&)> key,
+    TaskScheduler& sched)
+{
+    std::size_t n = src.GetLength();
+    std::size_t parts = sched.GetWorkerCount() * 4;
+    if (n < 4096 || parts <= 1) return GroupBy<T, K>(src, key);
+
+    std::size_t chunks = parts;
+    std::size_t chunkLen = (n + chunks - 1) / chunks;
+    DynamicArray<K> keys(n);
+    DynamicArray<std::uint32_t> partIds(n);
+    DynamicArray<std::size_t> counts(chunks * parts);  // counts[c * parts + p]
+
+    {
+        TaskGroup g(sched);
+        for (std::size_t c = 0; c < chunks; ++c) {
+            g.Run([&, c] {
+                std::size_t lo = c * chunkLen, hi = lo + chunkLen < n ? lo + chunkLen : n;
+                for (std::size_t i = lo; i < hi; ++i) {
+                    keys[i] = key(src.Get(i));
+                    std::size_t p = grouping_detail::partOf(keys[i], parts);
+                    partIds[i] = static_cast<std::uint32_t>(p);
+                    ++counts[c * parts + p];
+                }
+            });
+        }
+        g.Wait();
+    }
+
+    // Смещения: часть p, внутри неё — куски по порядку
+    DynamicArray<std::size_t> offsets(chunks * parts);
+    DynamicArray<std::size_t> partStart(parts + 1);
+    std::size_t acc = 0;
+    for (std::size_t p = 0; p < parts; ++p) {
+        partStart[p] = acc;
+        for (std::size_t c = 0; c < chunks; ++c) {
+            offsets[c * parts + p] = acc;
+            acc += counts[c * parts + p];
+        }
+    }
+    partStart[parts] = acc;
+
+    DynamicArray<std::size_t> order(n);
+    {
+        TaskGroup g(sched);
+        for (std::size_t c = 0; c < chunks; ++c) {
+            g.Run([&, c] {
+                std::size_t lo = c * chunkLen, hi = lo + chunkLen < n ? lo + chunkLen : n;
+                std::size_t* off = offsets.Data() + c * parts;
+                for (std::size_t i = lo; i < hi; ++i)
+                    order[off[partIds[i]]++] = i;
+            });
+        }
+        g.Wait();
+    }
+
+    DynamicArray<Groups<K, T>> local(parts);
+    {
+        TaskGroup g(sched);
+        for (std::size_t p = 0; p < parts; ++p) {
+            g.Run([&, p] {
+                Groups<K, T>& m = local[p];
+                m.Reserve(partStart[p + 1] - partStart[p]);
+                for (std::size_t j = partStart[p]; j < partStart[p + 1]; ++j) {
+                    std::size_t i = order[j];
+                    m[keys[i]].Append(src.Get(i));
+                }
+            });
+        }
+        g.Wait();
+    }
+
+    std::size_t total = 0;
+    for (std::size_t p = 0; p < parts; ++p) total += local[p].GetLength();
+    Groups<K, T> groups(total);
+    for (std::size_t p = 0; p < parts; ++p)
+        local[p].ForEach([&](const K& k, const MutableArraySequence<T>& items) {
+            groups.Insert(k, items);  // CowArray: копия разделяет буфер
+        });
+    return groups;
+}
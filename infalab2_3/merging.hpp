@@ -0,0 +1,208 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "MutableArraySequence.hpp"
+#include "Queue.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+// Ленивое k-путевое слияние отсортированных источников на дереве проигравших:
+// каждый следующий элемент — O(log k) сравнений. Источники:
+//  - Sequence — читается курсором Sequence::Reader (у списков — по узлам)
+//    и не изменяется (должна жить до конца слияния);
+//  - QueueSequence — элементы забираются через Dequeue по мере слияния
+//    (опустевшая очередь считается исчерпанной).
+// Равные элементы выдаются в порядке добавления источников (слияние устойчиво).
+// Интерфейс читателя (value_type, Next, ReadChunk) — как в StreamReader.hpp:
+// слияние в целевую последовательность — ReadInto(merge, target).
+template<typename T, typename Compare = std::less<T>>
+class KWayMerge {
+public:
+    using value_type = T;
+
+private:
+    struct Source {
+        std::function<bool(T&)> next;   // курсор Sequence::Reader
+        QueueSequence<T>* queue{nullptr};
+        T head{};
+        bool alive{false};
+    };
+
+    DynamicArray<Source> src_;
+    std::size_t count_{0};
+    DynamicArray<std::size_t> losers_;   // losers_[1..k-1]: проигравший в узле
+    std::size_t winner_{0};
+    bool built_{false};
+    Compare cmp_;
+
+    void advance(Source& s) {
+        if (s.queue) {
+            s.alive = s.queue->GetLength() > 0;
+            if (s.alive) s.head = s.queue->Dequeue();
+        } else {
+            s.alive = s.next(s.head);
+        }
+    }
+
+    // Источник a выигрывает у b: меньшая голова, при равенстве — меньший номер
+    bool beats(std::size_t a, std::size_t b) {
+        const Source& x = src_[a];
+        const Source& y = src_[b];
+        if (!x.alive) return false;
+        if (!y.alive) return true;
+        if (cmp_(x.head, y.head)) return true;
+        if (cmp_(y.head, x.head)) return false;
+        return a < b;
+    }
+
+    // Турнир в поддереве node; возвращает победителя, проигравших записывает в losers_
+    std::size_t play(std::size_t node) {
+        if (node >= count_) return node - count_;
+        std::size_t l = play(2 * node), r = play(2 * node + 1);
+        if (beats(l, r)) {
+            losers_[node] = r;
+            return l;
+        }
+        losers_[node] = l;
+        return r;
+    }
+
+    void build() {
+        losers_ = DynamicArray<std::size_t>(count_ ? count_ : 1);
+        winner_ = count_ ? play(1) : 0;
+        built_ = true;
+    }
+
+    void addSource(Source s) {
+        if (count_ == src_.GetSize()) src_.Resize(count_ ? count_ * 2 : 4);
+        advance(s);
+        src_[count_++] = std::move(s);
+        built_ = false;
+    }
+
+public:
+    explicit KWayMerge(Compare cmp = Compare()) : cmp_(std::move(cmp)) {}
+
+    // --- Источники ---
+    void AddSource(const Sequence<T>& seq) {
+        Source s;
+        s.next = seq.Reader();
+        addSource(std::move(s));
+    }
+    void AddSource(QueueSequence<T>& queue) {
+        Source s;
+        s.queue = &queue;
+        addSource(std::move(s));
+    }
+
+    std::size_t GetSourceCount() const {
+        return count_;
+    }
+
+    // --- Чтение ---
+    bool Next(T& out) {
+        if (!built_) build();
+        if (count_ == 0) return false;
+        Source& w = src_[winner_];
+        if (!w.alive) return false;
+        out = std::move(w.head);
+        advance(w);
+        // Переигрывание пути от листа победителя к корню
+        std::size_t cur = winner_;
+        for (std::size_t node = (winner_ + count_) / 2; node >= 1; node /= 2) {
+            if (beats(losers_[node], cur)) std::swap(losers_[node], cur);
+        }
+        winner_ = cur;
+        return true;
+    }
+
+    std::size_t ReadChunk(T* dst, std::size_t max) {
+        std::size_t n = 0;
+        while (n < max && Next(dst[n])) ++n;
+        return n;
+    }
+};
+
+// Слияние отсортированных последовательностей в одну (ёмкость выделяется сразу)
+template<typename T, typename Compare = std::less<T>>
+typename Sequence<T>::SeqUPtr MergeSorted(
+    const Sequence<Sequence<T>*>& sources,
+    Compare cmp = Compare())
+{
+    KWayMerge<T, Compare> merge(std::move(cmp));
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < sources.GetLength(); ++i) {
+        merge.AddSource(*sources.Get(i));
+        total += sources.Get(i)->GetLength();
+    }
+    DynamicArray<T> out(total);
+    merge.ReadChunk(out.Data(), total);
+    return std::make_unique<MutableArraySequence<T>>(std::move(out));
+}
+
+// Соединение слиянием двух последовательностей, отсортированных по ключу.
+// Для каждой пары равных ключей — combine(a_i, b_j); серии равных ключей дают
+// все попарные сочетания. O(n + m + размер результата): обе стороны читаются
+// курсорами Reader, ключ каждого элемента считается один раз, серия b
+// с текущим ключом копируется в буфер и переиспользуется для всех a серии.
+template<typename A, typename B, typename K, typename R>
+typename Sequence<R>::SeqUPtr MergeJoin(
+    const Sequence<A>& a,
+    const Sequence<B>& b,
+    std::function<K(const A&)> keyA,
+    std::function<K(const B&)> keyB,
+    std::function<R(const A&, const B&)> combine)
+{
+    auto out = std::make_unique<MutableArraySequence<R>>();
+    auto nextA = a.Reader();
+    auto nextB = b.Reader();
+    A x;
+    B y;
+    if (!nextA(x) || !nextB(y)) return out;
+    K ka = keyA(x), kb = keyB(y);
+    DynamicArray<B> run;   // серия b с ключом ka; буфер растёт и переиспользуется
+    for (;;) {
+        if (ka < kb) {
+            if (!nextA(x)) break;
+            ka = keyA(x);
+            continue;
+        }
+        if (kb < ka) {
+            if (!nextB(y)) break;
+            kb = keyB(y);
+            continue;
+        }
+        std::size_t len = 0;
+        bool moreB;
+        do {
+            if (len == run.GetSize()) run.Resize(len + 1);
+            run[len++] = y;
+            moreB = nextB(y);
+            if (moreB) kb = keyB(y);
+        } while (moreB && !(ka < kb));
+        K key = ka;
+        bool moreA;
+        do {
+            for (std::size_t k = 0; k < len; ++k)
+                out->Append(combine(x, run[k]));
+            moreA = nextA(x);
+            if (moreA) ka = keyA(x);
+        } while (moreA && !(key < ka));
+        if (!moreA || !moreB) break;
+    }
+    return out;
+}
+
+template<typename A, typename B, typename K>
+typename Sequence<std::pair<A,B>>::SeqUPtr MergeJoin(
+    const Sequence<A>& a,
+    const Sequence<B>& b,
+    std::function<K(const A&)> keyA,
+    std::function<K(const B&)> keyB)
+{
+    return MergeJoin<A, B, K, std::pair<A,B>>(a, b, keyA, keyB,
+        [](const A& x, const B& y) { return std::pair<A,B>(x, y); });
+}
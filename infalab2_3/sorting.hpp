@@ -0,0 +1,304 @@
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "MutableArraySequence.hpp"
+#include "MutableListSequence.hpp"
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+constexpr std::size_t kInsertionSortThreshold = 16;
+constexpr std::size_t kParallelSortThreshold  = 1 << 20;   // с какого размера Sort распараллеливается
+constexpr std::size_t kParallelSortMinChunk   = 1 << 16;
+
+namespace sort_detail {
+
+template<typename T, typename Compare>
+void insertionSort(T* first, T* last, Compare& cmp) {
+    if (first == last) return;
+    for (T* i = first + 1; i < last; ++i) {
+        T v = std::move(*i);
+        T* j = i;
+        while (j > first && cmp(v, *(j - 1))) {
+            *j = std::move(*(j - 1));
+            --j;
+        }
+        *j = std::move(v);
+    }
+}
+
+template<typename T, typename Compare>
+void siftDown(T* a, std::size_t root, std::size_t n, Compare& cmp) {
+    T v = std::move(a[root]);
+    for (;;) {
+        std::size_t child = 2 * root + 1;
+        if (child >= n) break;
+        if (child + 1 < n && cmp(a[child], a[child + 1])) ++child;
+        if (!cmp(v, a[child])) break;
+        a[root] = std::move(a[child]);
+        root = child;
+    }
+    a[root] = std::move(v);
+}
+
+template<typename T, typename Compare>
+void heapSort(T* first, T* last, Compare& cmp) {
+    std::size_t n = static_cast<std::size_t>(last - first);
+    for (std::size_t i = n / 2; i-- > 0; )
+        siftDown(first, i, n, cmp);
+    for (std::size_t end = n; end-- > 1; ) {
+        std::swap(first[0], first[end]);
+        siftDown(first, 0, end, cmp);
+    }
+}
+
+// Медиана из a, b, c переставляется в result
+template<typename T, typename Compare>
+void moveMedianToFirst(T* result, T* a, T* b, T* c, Compare& cmp) {
+    if (cmp(*a, *b)) {
+        if (cmp(*b, *c))      std::swap(*result, *b);
+        else if (cmp(*a, *c)) std::swap(*result, *c);
+        else                  std::swap(*result, *a);
+    } else if (cmp(*a, *c))   std::swap(*result, *a);
+    else if (cmp(*b, *c))     std::swap(*result, *c);
+    else                      std::swap(*result, *b);
+}
+
+// Разбиение Хоара без проверок границ: опорный элемент в *pivot
+template<typename T, typename Compare>
+T* unguardedPartition(T* lo, T* hi, T* pivot, Compare& cmp) {
+    for (;;) {
+        while (cmp(*lo, *pivot)) ++lo;
+        --hi;
+        while (cmp(*pivot, *hi)) --hi;
+        if (!(lo < hi)) return lo;
+        std::swap(*lo, *hi);
+        ++lo;
+    }
+}
+
+template<typename T, typename Compare>
+void introsortLoop(T* first, T* last, std::size_t depth, Compare& cmp) {
+    while (static_cast<std::size_t>(last - first) > kInsertionSortThreshold) {
+        if (depth == 0) {
+            heapSort(first, last, cmp);
+            return;
+        }
+        --depth;
+        T* mid = first + (last - first) / 2;
+        moveMedianToFirst(first, first + 1, mid, last - 1, cmp);
+        T* cut = unguardedPartition(first + 1, last, first, cmp);
+        introsortLoop(cut, last, depth, cmp);
+        last = cut;
+    }
+    insertionSort(first, last, cmp);
+}
+
+template<typename T, typename Compare>
+void mergeRuns(const T* a, std::size_t na, const T* b, std::size_t nb, T* out, Compare& cmp) {
+    std::size_t i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        if (cmp(b[j], a[i])) out[k++] = b[j++];
+        else                 out[k++] = a[i++];
+    }
+    while (i < na) out[k++] = a[i++];
+    while (j < nb) out[k++] = b[j++];
+}
+
+// Копия последовательности в буфер за один проход (по узлам у списков)
+template<typename T>
+DynamicArray<T> collect(const Sequence<T>& seq) {
+    DynamicArray<T> buf(seq.GetLength());
+    std::size_t i = 0;
+    seq.ForEach([&](const T& v) { buf[i++] = v; });
+    return buf;
+}
+
+} // namespace sort_detail
+
+// --- Сортировки над буфером ---
+
+template<typename T, typename Compare = std::less<T>>
+void IntroSort(T* first, T* last, Compare cmp = Compare()) {
+    std::size_t n = static_cast<std::size_t>(last - first);
+    if (n < 2) return;
+    std::size_t depth = 0;
+    for (std::size_t k = n; k > 1; k >>= 1) depth += 2;
+    sort_detail::introsortLoop(first, last, depth, cmp);
+}
+
+// Устойчивая восходящая сортировка слиянием с буфером на n элементов
+template<typename T, typename Compare = std::less<T>>
+void MergeSortBuffer(T* a, std::size_t n, Compare cmp = Compare()) {
+    if (n < 2) return;
+    const std::size_t run = 32;
+    for (std::size_t i = 0; i < n; i += run)
+        sort_detail::insertionSort(a + i, a + (i + run < n ? i + run : n), cmp);
+    if (n <= run) return;
+
+    DynamicArray<T> tmp(n);
+    T* src = a;
+    T* dst = tmp.Data();
+    for (std::size_t width = run; width < n; width *= 2) {
+        for (std::size_t lo = 0; lo < n; lo += 2 * width) {
+            std::size_t mid = lo + width < n ? lo + width : n;
+            std::size_t hi  = lo + 2 * width < n ? lo + 2 * width : n;
+            sort_detail::mergeRuns(src + lo, mid - lo, src + mid, hi - mid, dst + lo, cmp);
+        }
+        std::swap(src, dst);
+    }
+    if (src != a)
+        for (std::size_t i = 0; i < n; ++i) a[i] = std::move(src[i]);
+}
+
+// Поразрядная LSD-сортировка по целочисленному ключу, устойчивая
+template<typename T, typename KeyFn>
+void RadixSort(T* a, std::size_t n, KeyFn key) {
+    using K = std::decay_t<decltype(key(*a))>;
+    static_assert(std::is_integral_v<K> && !std::is_same_v<K, bool>,
+                  "RadixSort: integral non-bool key required");
+    using U = std::make_unsigned_t<K>;
+    if (n < 2) return;
+
+    auto ukey = [&](const T& v) -> U {
+        U u = static_cast<U>(key(v));
+        if constexpr (std::is_signed_v<K>)
+            u ^= U(1) << (std::numeric_limits<U>::digits - 1);
+        return u;
+    };
+
+    DynamicArray<T> tmp(n);
+    T* src = a;
+    T* dst = tmp.Data();
+    for (std::size_t shift = 0; shift < sizeof(U) * 8; shift += 8) {
+        std::size_t count[256] = {};
+        for (std::size_t i = 0; i < n; ++i)
+            ++count[(ukey(src[i]) >> shift) & 0xFF];
+        if (count[(ukey(src[0]) >> shift) & 0xFF] == n) continue;   // разряд у всех одинаков
+
+        std::size_t pos = 0;
+        for (std::size_t d = 0; d < 256; ++d) {
+            std::size_t c = count[d];
+            count[d] = pos;
+            pos += c;
+        }
+        for (std::size_t i = 0; i < n; ++i)
+            dst[count[(ukey(src[i]) >> shift) & 0xFF]++] = std::move(src[i]);
+        std::swap(src, dst);
+    }
+    if (src != a)
+        for (std::size_t i = 0; i < n; ++i) a[i] = std::move(src[i]);
+}
+
+// Параллельная сортировка: IntroSort по блокам в потоках, затем попарные слияния
+template<typename T, typename Compare = std::less<T>>
+void ParallelSort(T* a, std::size_t n, Compare cmp = Compare(), unsigned threads = 0) {
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    std::size_t parts = threads ? threads : 1;
+    if (parts > n / kParallelSortMinChunk) parts = n / kParallelSortMinChunk;
+    if (parts < 2) {
+        IntroSort(a, a + n, cmp);
+        return;
+    }
+
+    DynamicArray<std::size_t> bounds(parts + 1);
+    for (std::size_t p = 0; p <= parts; ++p)
+        bounds[p] = n * p / parts;
+    {
+        DynamicArray<std::thread> pool(parts);
+        for (std::size_t p = 0; p < parts; ++p)
+            pool[p] = std::thread([&, p]{ IntroSort(a + bounds[p], a + bounds[p + 1], cmp); });
+        for (std::size_t p = 0; p < parts; ++p) pool[p].join();
+    }
+
+    DynamicArray<T> tmp(n);
+    T* src = a;
+    T* dst = tmp.Data();
+    for (std::size_t width = 1; width < parts; width *= 2) {
+        std::size_t groups = (parts + 2 * width - 1) / (2 * width);
+        DynamicArray<std::thread> pool(groups);
+        for (std::size_t g = 0; g < groups; ++g) {
+            std::size_t lo  = bounds[g * 2 * width];
+            std::size_t mid = bounds[(g * 2 + 1) * width < parts ? (g * 2 + 1) * width : parts];
+            std::size_t hi  = bounds[(g + 1) * 2 * width < parts ? (g + 1) * 2 * width : parts];
+            pool[g] = std::thread([&, lo, mid, hi]{
+                Compare c = cmp;
+                sort_detail::mergeRuns(src + lo, mid - lo, src + mid, hi - mid, dst + lo, c);
+            });
+        }
+        for (std::size_t g = 0; g < groups; ++g) pool[g].join();
+        std::swap(src, dst);
+    }
+    if (src != a)
+        for (std::size_t i = 0; i < n; ++i) a[i] = std::move(src[i]);
+}
+
+// --- Сортировки последовательностей ---
+
+// Массивы сортируются на месте в буфере хранилища
+template<typename T, typename S, typename Compare = std::less<T>>
+void Sort(MutableArraySequence<T, S>& seq, Compare cmp = Compare()) {
+    std::size_t n = seq.GetLength();
+    T* a = seq.GetStorage().Data();
+    if (n >= kParallelSortThreshold) ParallelSort(a, n, cmp);
+    else                             IntroSort(a, a + n, cmp);
+}
+
+template<typename T, typename S, typename Compare = std::less<T>>
+void StableSort(MutableArraySequence<T, S>& seq, Compare cmp = Compare()) {
+    MergeSortBuffer(seq.GetStorage().Data(), seq.GetLength(), cmp);
+}
+
+// Списки сортируются слиянием с перевязкой узлов (всегда устойчиво)
+template<typename T, typename L, typename Compare = std::less<T>>
+void Sort(MutableListSequence<T, L>& seq, Compare cmp = Compare()) {
+    seq.Sort(cmp);
+}
+
+template<typename T, typename L, typename Compare = std::less<T>>
+void StableSort(MutableListSequence<T, L>& seq, Compare cmp = Compare()) {
+    seq.Sort(cmp);
+}
+
+// Произвольная последовательность: сбор в буфер одним проходом ForEach и одна
+// перезапись через Overwrite (у списков — пересборка, а не поиск узла на индекс).
+// Неизменяемые последовательности и очередь бросают logic_error, не меняясь.
+template<typename T, typename Compare = std::less<T>>
+void Sort(Sequence<T>& seq, Compare cmp = Compare()) {
+    DynamicArray<T> buf = sort_detail::collect(seq);
+    IntroSort(buf.Data(), buf.Data() + buf.GetSize(), cmp);
+    seq.Overwrite(buf.Data());
+}
+
+template<typename T, typename Compare = std::less<T>>
+void StableSort(Sequence<T>& seq, Compare cmp = Compare()) {
+    DynamicArray<T> buf = sort_detail::collect(seq);
+    MergeSortBuffer(buf.Data(), buf.GetSize(), cmp);
+    seq.Overwrite(buf.Data());
+}
+
+// --- Сортировка по ключу ---
+
+template<typename Seq, typename KeyFn>
+void SortBy(Seq& seq, KeyFn key) {
+    Sort(seq, [&](const auto& a, const auto& b){ return key(a) < key(b); });
+}
+
+template<typename Seq, typename KeyFn>
+void StableSortBy(Seq& seq, KeyFn key) {
+    StableSort(seq, [&](const auto& a, const auto& b){ return key(a) < key(b); });
+}
+
+template<typename T, typename S, typename KeyFn>
+void RadixSortBy(MutableArraySequence<T, S>& seq, KeyFn key) {
+    RadixSort(seq.GetStorage().Data(), seq.GetLength(), key);
+}
+
+template<typename T, typename S>
+void RadixSort(MutableArraySequence<T, S>& seq) {
+    RadixSortBy(seq, [](const T& v){ return v; });
+}
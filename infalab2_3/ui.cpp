@@ -2,6 +2,11 @@
 #include <string>
 #include <cassert>
 #include <chrono>
+#include <sstream>
+#include <cstdio>
+#include <thread>
+#include <utility>
+#include <cstdint>
 
 #include "DynamicArray.hpp"
 #include "LinkedList.hpp"
@@ -12,12 +17,82 @@
 #include "ImmutableListSequence.hpp"
 #include "algorithms.hpp"
 #include "Queue.hpp"
+#include "StreamReader.hpp"
+#include "MappedArraySequence.hpp"
+#include "sorting.hpp"
+#include "HashIndex.hpp"
+#include "SortedSequence.hpp"
+#include "BlockingQueue.hpp"
+#include "PriorityQueue.hpp"
+#include "DequeArraySequence.hpp"
+#include "GapBufferSequence.hpp"
+#include "FixedArraySequence.hpp"
+#include "ZippedSequence.hpp"
+#include "Generator.hpp"
+#include "AsyncPipeline.hpp"
+#include "TaskScheduler.hpp"
+#include "AggregateSequence.hpp"
+#include "WindowedQueue.hpp"
+#include "grouping.hpp"
+#include "merging.hpp"
+#include "BitSequence.hpp"
+#include "CompressedIntSequence.hpp"
+#include "StringSequence.hpp"
+#include "SegmentedArraySequence.hpp"
 
 void runLab2Tests();
 void demoLab2();
 void runLab3Tests();
 void demoLab3();
 void benchLab3();
+void runExtTests();
+void runStreamTests();
+void runMappedTests();
+void runSortTests();
+void runHashIndexTests();
+void runSortedTests();
+void runBlockingQueueTests();
+void runPriorityQueueTests();
+void runDequeTests();
+void runGapBufferTests();
+void runFixedArrayTests();
+void runZippedTests();
+void runCowTests();
+void runPolicyArrayTests();
+void runCoroutineTests();
+void runSchedulerTests();
+void runAggregateTests();
+void runWindowedQueueTests();
+void runGroupingTests();
+void runMergeTests();
+void runStaticAlgorithmTests();
+void runPooledListTests();
+void runPackedSequenceTests();
+void runStringSequenceTests();
+void runSegmentedArrayTests();
+void runBulkCopyTests();
+void benchExt();
+void benchMapped();
+void benchHashIndex();
+void benchPipeline();
+void benchHeapArity();
+void benchPrepend();
+void benchGapBuffer();
+void benchColumns();
+void benchCow();
+void benchPolicies();
+void benchCoroutines();
+void benchScheduler();
+void benchAggregate();
+void benchWindowedQueue();
+void benchGrouping();
+void benchMerge();
+void benchStaticAlgorithms();
+void benchPooledList();
+void benchPackedSequences();
+void benchStringQueue();
+void benchSegmentedArray();
+void benchBulkCopy();
 
 int main() {
     while (true) {
@@ -27,6 +102,8 @@ int main() {
                   << "3) Запустить тесты ЛР 3\n"
                   << "4) Демонстрация очереди ЛР 3\n"
                   << "5) Бенчмарк Append (Массив/Список/Очередь)\n"
+                  << "6) Запустить тесты расширений\n"
+                  << "7) Бенчмарки расширений\n"
                   << "0) Выход\n"
                   << "Выберите> ";
         int c;
@@ -37,6 +114,8 @@ int main() {
             case 3: runLab3Tests();  break;
             case 4: demoLab3();      break;
             case 5: benchLab3();     break;
+            case 6: runExtTests();   break;
+            case 7: benchExt();      break;
             case 0: std::cout << "До свидания!\n"; return 0;
             default: std::cout << "Некорректный выбор\n";
         }
@@ -242,3 +321,2783 @@ void benchLab3() {
         for (std::size_t i = 0; i < N; ++i) p->Append((int)i);
     });
 }
+
+void runExtTests() {
+    std::cout << "\n-- Тесты расширений --\n";
+    runStreamTests();
+    runMappedTests();
+    runSortTests();
+    runHashIndexTests();
+    runSortedTests();
+    runBlockingQueueTests();
+    runPriorityQueueTests();
+    runDequeTests();
+    runGapBufferTests();
+    runFixedArrayTests();
+    runZippedTests();
+    runCowTests();
+    runPolicyArrayTests();
+    runCoroutineTests();
+    runSchedulerTests();
+    runAggregateTests();
+    runWindowedQueueTests();
+    runGroupingTests();
+    runMergeTests();
+    runStaticAlgorithmTests();
+    runPooledListTests();
+    runPackedSequenceTests();
+    runStringSequenceTests();
+    runSegmentedArrayTests();
+    runBulkCopyTests();
+}
+
+void benchExt() {
+    std::cout << "\n-- Бенчмарки расширений --\n"
+              << "1) Массив в памяти vs отображённый файл\n"
+              << "2) HashIndex vs линейный TryFind\n"
+              << "3) Конвейер на BlockingQueue: размер пакета\n"
+              << "4) PriorityQueue: арность кучи 2/4/8\n"
+              << "5) Prepend: MutableArraySequence vs DequeArraySequence\n"
+              << "6) InsertAt у курсора: MutableArraySequence vs GapBufferSequence\n"
+              << "7) Свёртка по .first: массив пар vs PairSequence\n"
+              << "8) Clone: глубокая копия vs копирование при записи\n"
+              << "9) Политики DynamicArray: рост и проверки индексов\n"
+              << "10) Map/Where: жадно vs генераторы vs асинхронный конвейер\n"
+              << "11) Планировщик с кражей работы: fork-join и поток задач\n"
+              << "12) Сумма на отрезке: Reduce по подпоследовательности vs AggregateSequence\n"
+              << "13) Скользящее окно: пересчёт по QueueSequence vs WindowedQueue\n"
+              << "14) Distinct/GroupBy/Join: вложенные TryFind vs хеш-таблица\n"
+              << "15) Слияние k отсортированных очередей: конкатенация + Sort vs KWayMerge\n"
+              << "16) Map/Where/Reduce: Sequence + std::function vs статические перегрузки\n"
+              << "17) Список: узлы в куче vs пул с 32-битными ссылками\n"
+              << "18) Флаги и отсортированные ID: массив vs BitSequence / CompressedIntSequence\n"
+              << "19) Очередь строк: QueueSequence<std::string> vs StringQueue на арене\n"
+              << "20) Рост: DynamicArray с удвоением vs SegmentedArraySequence (пик памяти)\n"
+              << "21) Копирование и вставка: поэлементно vs memcpy/memmove по размерам\n"
+              << "Выберите> ";
+    int c;
+    if (!(std::cin >> c)) return;
+    switch (c) {
+        case 1: benchMapped(); break;
+        case 2: benchHashIndex(); break;
+        case 3: benchPipeline(); break;
+        case 4: benchHeapArity(); break;
+        case 5: benchPrepend(); break;
+        case 6: benchGapBuffer(); break;
+        case 7: benchColumns(); break;
+        case 8: benchCow(); break;
+        case 9: benchPolicies(); break;
+        case 10: benchCoroutines(); break;
+        case 11: benchScheduler(); break;
+        case 12: benchAggregate(); break;
+        case 13: benchWindowedQueue(); break;
+        case 14: benchGrouping(); break;
+        case 15: benchMerge(); break;
+        case 16: benchStaticAlgorithms(); break;
+        case 17: benchPooledList(); break;
+        case 18: benchPackedSequences(); break;
+        case 19: benchStringQueue(); break;
+        case 20: benchSegmentedArray(); break;
+        case 21: benchBulkCopy(); break;
+        default: std::cout << "Некорректный выбор\n";
+    }
+}
+
+void runStreamTests() {
+    {
+        std::istringstream in("1 2\n3\t4   5\n-6");
+        NumberReader<int> r(in, 4);
+        MutableArraySequence<int> seq;
+        assert(ReadInto(r, seq, 2) == 6);
+        assert(seq.GetLength() == 6 && seq.Get(0) == 1 && seq.GetLast() == -6);
+    }
+    {
+        std::istringstream in("alpha\r\nbeta\n\ngamma");
+        LineReader r(in);
+        QueueSequence<std::string> q;
+        assert(ReadInto(r, q) == 4);
+        assert(q.Dequeue() == "alpha" && q.Dequeue() == "beta");
+        assert(q.Dequeue().empty() && q.Dequeue() == "gamma");
+    }
+    {
+        std::istringstream in("1.5 2.5 x");
+        NumberReader<double> r(in);
+        double v;
+        assert(r.Next(v) && v == 1.5 && r.Next(v) && v == 2.5);
+        bool caught = false;
+        try { r.Next(v); } catch (const std::runtime_error&) { caught = true; }
+        assert(caught);
+    }
+    {
+        std::string text;
+        for (int i = 1; i <= 1000; ++i) text += std::to_string(i) + ' ';
+        std::istringstream in(text);
+        NumberReader<int> r(in, 64);
+        long sum = ReduceChunked(r, 0L, [](const long& acc, const int& x){ return acc + x; }, 7);
+        assert(sum == 500500);
+
+        std::istringstream in2(text);
+        NumberReader<int> r2(in2, 64);
+        MutableListSequence<int> even;
+        assert(WhereChunked(r2, [](const int& x){ return x % 2 == 0; }, even, 9) == 500);
+        assert(even.GetFirst() == 2 && even.GetLast() == 1000);
+
+        std::istringstream in3(text);
+        NumberReader<int> r3(in3);
+        std::size_t chunks = 0, maxLen = 0;
+        ForEachChunk(r3, 100, [&](const Sequence<int>& part){
+            ++chunks;
+            if (part.GetLength() > maxLen) maxLen = part.GetLength();
+        });
+        assert(chunks == 10 && maxLen == 100);
+    }
+    {
+        struct Rec { int id; double w; };
+        std::FILE* f = std::tmpfile();
+        assert(f);
+        for (int i = 0; i < 50; ++i) {
+            Rec rec{i, i * 0.5};
+            std::fwrite(&rec, sizeof rec, 1, f);
+        }
+        std::fflush(f);
+        std::rewind(f);
+        RecordReader<Rec> r(fileno(f), 3 * sizeof(Rec) + 1);
+        MutableArraySequence<Rec> recs;
+        assert(ReadInto(r, recs, 8) == 50);
+        assert(recs.Get(49).id == 49 && recs.Get(10).w == 5.0);
+        std::fclose(f);
+    }
+    std::cout << "Тесты потокового чтения пройдены!\n";
+}
+
+void runMappedTests() {
+    {
+        MappedArraySequence<int> seq;
+        for (int i = 0; i < 5000; ++i) seq.Append(i);
+        assert(seq.GetLength() == 5000 && seq.GetLast() == 4999);
+        seq.Prepend(-1);
+        seq.InsertAt(42, 3);
+        assert(seq.Get(0) == -1 && seq.Get(3) == 42 && seq.Get(4) == 2);
+
+        seq.GetStorage().Advise(AccessHint::Sequential);
+        long sum = Reduce<int,long>(seq, 0L, [](const long& s, const int& v){ return s + v; });
+        assert(sum == 4999L * 5000 / 2 - 1 + 42);
+
+        auto even = Where<int>(seq, [](int v){ return v % 2 == 0; });
+        assert(even->GetLength() == 2501);
+
+        auto cp = seq.Clone();
+        seq[0] = 7;
+        assert(cp->Get(0) == -1 && seq.Get(0) == 7);
+
+        auto sub = seq.GetSubsequence(1, 3);
+        assert(sub->GetLength() == 3 && sub->Get(2) == 42);
+    }
+    {
+        const char* dir = std::getenv("TMPDIR");
+        std::string path = std::string(dir && *dir ? dir : "/tmp") + "/infalab-mapped-test.bin";
+        {
+            MappedArraySequence<double> seq{MappedArray<double>(path)};
+            seq.Append(1.5);
+            seq.Append(2.5);
+        }
+        {
+            MappedArraySequence<double> seq{MappedArray<double>(path)};
+            assert(seq.GetLength() == 2 && seq.Get(1) == 2.5);
+        }
+        // Хвост не кратен sizeof(T): ошибка без усечения файла и без утечки дескриптора
+        {
+            int fd = ::open(path.c_str(), O_WRONLY | O_APPEND);
+            assert(fd >= 0 && ::write(fd, "abc", 3) == 3);
+            ::close(fd);
+        }
+        int probe = ::open("/dev/null", O_RDONLY);
+        ::close(probe);
+        bool threw = false;
+        try { MappedArray<double> bad(path); } catch (const std::runtime_error&) { threw = true; }
+        struct stat st;
+        assert(threw && ::stat(path.c_str(), &st) == 0 && st.st_size == 2 * sizeof(double) + 3);
+        int probe2 = ::open("/dev/null", O_RDONLY);
+        assert(probe2 == probe);
+        ::close(probe2);
+        ::unlink(path.c_str());
+    }
+    std::cout << "Тесты MappedArraySequence пройдены!\n";
+}
+
+void benchMapped() {
+    std::cout << "Количество элементов int (для проверки вне ОЗУ — больше объёма памяти)> ";
+    std::size_t n;
+    if (!(std::cin >> n) || n == 0) return;
+    using Clock = std::chrono::high_resolution_clock;
+
+    auto run = [&](const char* label, auto& seq, auto advise) {
+        auto t0 = Clock::now();
+        for (std::size_t i = 0; i < n; ++i) seq[i] = (int)i;
+        auto t1 = Clock::now();
+        advise(AccessHint::Sequential);
+        long long sum = 0;
+        for (std::size_t i = 0; i < n; ++i) sum += seq.Get(i);
+        auto t2 = Clock::now();
+        advise(AccessHint::Random);
+        std::size_t x = 12345;
+        const std::size_t probes = n < 1000000 ? n : 1000000;
+        for (std::size_t i = 0; i < probes; ++i) {
+            x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+            sum += seq.Get((x >> 17) % n);
+        }
+        auto t3 = Clock::now();
+        auto ms = [](auto a, auto b){
+            return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count();
+        };
+        std::cout << label << ": заполнение " << ms(t0, t1) << " ms, последовательное чтение "
+                  << ms(t1, t2) << " ms, " << probes << " случайных чтений " << ms(t2, t3)
+                  << " ms (контрольная сумма " << sum << ")\n";
+    };
+
+    {
+        MutableArraySequence<int> mem{DynamicArray<int>(n)};
+        run("В памяти (DynamicArray)", mem, [](AccessHint){});
+    }
+    {
+        MappedArraySequence<int> mapped{MappedArray<int>(n)};
+        run("Отображённый файл (MappedArray)", mapped,
+            [&](AccessHint h){ mapped.GetStorage().Advise(h); });
+    }
+}
+
+void runSortTests() {
+    std::size_t x = 88172645463325252ULL;
+    auto rnd = [&]{
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        return x;
+    };
+    auto sorted = [](const Sequence<int>& s){
+        for (std::size_t i = 1; i < s.GetLength(); ++i)
+            if (s.Get(i) < s.Get(i - 1)) return false;
+        return true;
+    };
+
+    {
+        MutableArraySequence<int> a;
+        for (int i = 0; i < 5000; ++i) a.Append((int)(rnd() % 1000) - 500);
+        long before = Reduce<int,long>(a, 0L, [](const long& s, const int& v){ return s + v; });
+        Sort(a);
+        assert(sorted(a));
+        long after = Reduce<int,long>(a, 0L, [](const long& s, const int& v){ return s + v; });
+        assert(after == before);
+
+        Sort(a, std::greater<int>());
+        assert(a.GetFirst() >= a.GetLast());
+        RadixSort(a);
+        assert(sorted(a) && a.GetFirst() < 0);
+    }
+    {
+        MutableArraySequence<std::pair<int,int>> p;
+        for (int i = 0; i < 3000; ++i) p.Append({(int)(rnd() % 10), i});
+        StableSortBy(p, [](const std::pair<int,int>& v){ return v.first; });
+        for (std::size_t i = 1; i < p.GetLength(); ++i) {
+            auto a = p.Get(i - 1), b = p.Get(i);
+            assert(a.first < b.first || (a.first == b.first && a.second < b.second));
+        }
+        RadixSortBy(p, [](const std::pair<int,int>& v){ return -v.second; });
+        assert(p.GetFirst().second == 2999 && p.GetLast().second == 0);
+    }
+    {
+        MutableListSequence<std::pair<int,int>> l;
+        for (int i = 0; i < 1000; ++i) l.Append({(int)(rnd() % 7), i});
+        StableSortBy(l, [](const std::pair<int,int>& v){ return v.first; });
+        for (std::size_t i = 1; i < l.GetLength(); ++i) {
+            auto a = l.Get(i - 1), b = l.Get(i);
+            assert(a.first < b.first || (a.first == b.first && a.second < b.second));
+        }
+        l.Append({-1, -1});
+        assert(l.GetLast().first == -1);
+    }
+    {
+        int arr[] = {5, 3, 9, 1, 7};
+        MutableListSequence<int> l(arr, 5);
+        Sequence<int>& erased = l;
+        Sort(erased);
+        assert(sorted(l) && l.GetFirst() == 1 && l.GetLast() == 9);
+
+        // Через Sequence&: дек пишется на месте, неизменяемые и очередь отказывают
+        DequeArraySequence<int> dq;
+        for (int v : arr) dq.Prepend(v);
+        Sequence<int>& edq = dq;
+        StableSort(edq);
+        assert(sorted(dq) && dq.GetLength() == 5);
+        ImmutableArraySequence<int> ia(arr, 5);
+        ImmutableListSequence<int> il(arr, 5);
+        QueueSequence<int> q;
+        for (int v : arr) q.Enqueue(v);
+        Sequence<int>* fixedOrder[] = {&ia, &il, &q};
+        for (Sequence<int>* s : fixedOrder) {
+            bool threw = false;
+            try { Sort(*s); } catch (const std::logic_error&) { threw = true; }
+            assert(threw && s->GetFirst() == 5 && s->GetLast() == 7);
+        }
+    }
+    {
+        const std::size_t n = 3 * kParallelSortMinChunk + 123;
+        MutableArraySequence<int> big{DynamicArray<int>(n)};
+        for (std::size_t i = 0; i < n; ++i) big[i] = (int)rnd();
+        ParallelSort(big.GetStorage().Data(), n, std::less<int>(), 4);
+        assert(sorted(big));
+    }
+    std::cout << "Тесты сортировок пройдены!\n";
+}
+
+void runHashIndexTests() {
+    using Rec = std::pair<int, std::string>;
+    {
+        MutableArraySequence<Rec> recs;
+        for (int i = 0; i < 1000; ++i) recs.Append({i % 100, "r" + std::to_string(i)});
+        HashIndex<Rec, int> byId(recs, [](const Rec& r){ return r.first; });
+        assert(byId.GetKeyCount() == 100);
+        assert(byId.Contains(42) && !byId.Contains(100));
+        assert(byId.Find(7).second == "r7");
+        assert(byId.Count(7) == 10);
+
+        auto all = byId.FindAll(7);
+        assert(all->GetLength() == 10 && all->Get(0).second == "r7" && all->GetLast().second == "r907");
+
+        recs.Append({100, "new"});
+        recs.Append({7, "tail"});
+        assert(byId.Contains(100) && byId.Count(7) == 11);
+        assert(byId.FindAll(7)->GetLast().second == "tail");
+
+        Rec out;
+        assert(!byId.TryFind(-1, out));
+        bool caught = false;
+        try { byId.Find(-1); } catch (const std::runtime_error&) { caught = true; }
+        assert(caught);
+        assert(byId.MemoryPerElement() > 0.0);
+    }
+    {
+        MutableListSequence<std::string> words;
+        words.Append("apple"); words.Append("avocado"); words.Append("banana");
+        HashIndex<std::string, char> byLetter(words, [](const std::string& w){ return w[0]; });
+        assert(byLetter.Count('a') == 2 && byLetter.IndexOf('b') == 2);
+        words.Prepend("cherry");
+        byLetter.Rebuild();
+        assert(byLetter.IndexOf('b') == 3 && byLetter.Find('c') == "cherry");
+    }
+    std::cout << "Тесты HashIndex пройдены!\n";
+}
+
+void benchHashIndex() {
+    const std::size_t N = 100000, Q = 2000;
+    using Clock = std::chrono::high_resolution_clock;
+    MutableArraySequence<int> seq{DynamicArray<int>(N)};
+    for (std::size_t i = 0; i < N; ++i) seq[i] = (int)(i * 7919 % N);
+
+    auto t0 = Clock::now();
+    long hits = 0;
+    for (std::size_t q = 0; q < Q; ++q) {
+        int key = (int)(q * 31 % N), out;
+        hits += TryFind<int>(seq, [key](const int& v){ return v == key; }, out);
+    }
+    auto t1 = Clock::now();
+    HashIndex<int, int> idx(seq, [](const int& v){ return v; });
+    auto t2 = Clock::now();
+    for (std::size_t q = 0; q < Q; ++q)
+        hits += idx.Contains((int)(q * 31 % N));
+    auto t3 = Clock::now();
+
+    auto us = [](auto a, auto b){
+        return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count();
+    };
+    std::cout << Q << " поисков TryFind: " << us(t0, t1) << " us\n"
+              << "Построение HashIndex: " << us(t1, t2) << " us\n"
+              << Q << " поисков HashIndex: " << us(t2, t3) << " us\n"
+              << "Память индекса: " << idx.MemoryUsage() << " байт ("
+              << idx.MemoryPerElement() << " байт/элемент), найдено " << hits << "\n";
+}
+
+void runSortedTests() {
+    {
+        int arr[] = {5, 1, 4, 1, 3, 9, 4, 4};
+        FlatSortedSequence<int> flat(arr, 8);
+        BTreeSortedSequence<int> tree(arr, 8);
+        for (Sequence<int>* s : {(Sequence<int>*)&flat, (Sequence<int>*)&tree}) {
+            assert(s->GetLength() == 8 && s->GetFirst() == 1 && s->GetLast() == 9);
+            s->Append(2);
+            assert(s->Get(2) == 2);
+            bool caught = false;
+            try { s->Prepend(0); } catch (const std::logic_error&) { caught = true; }
+            assert(caught);
+        }
+        auto [lo, hi] = tree.EqualRange(4);
+        assert(lo == 4 && hi == 7);
+        assert(flat.CountRange(2, 4) == 5 && tree.CountRange(2, 4) == 5);
+        assert(tree.Contains(9) && !tree.Contains(7));
+        assert(tree.Remove(4) && tree.CountRange(4, 4) == 2);
+        assert(!tree.Remove(7));
+        int sum = 0;
+        tree.ForEachInRange(3, 5, [&](const int& v){ sum += v; });
+        assert(sum == 3 + 4 + 4 + 5);
+    }
+    {
+        // Случайные вставки и удаления: B+-дерево должно совпадать с плоским массивом
+        std::size_t x = 2463534242ULL;
+        auto rnd = [&]{
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            return x;
+        };
+        FlatSortedSequence<int> flat;
+        BTreeSortedSequence<int> tree;
+        for (int step = 0; step < 30000; ++step) {
+            int v = (int)(rnd() % 2000);
+            if (rnd() % 3 == 0) {
+                assert(flat.Remove(v) == tree.Remove(v));
+            } else {
+                flat.Add(v);
+                tree.Add(v);
+            }
+            if (step % 1000 == 0) {
+                assert(flat.GetLength() == tree.GetLength());
+                for (std::size_t i = 0; i < flat.GetLength(); ++i)
+                    assert(flat.Get(i) == tree.Get(i));
+            }
+            int q = (int)(rnd() % 2100);
+            assert(flat.LowerBound(q) == tree.LowerBound(q));
+            assert(flat.UpperBound(q) == tree.UpperBound(q));
+        }
+        std::size_t seen = 0;
+        int prev = -1;
+        bool ordered = true;
+        tree.ForEachInRange(0, 2000, [&](const int& v){ ordered &= prev <= v; prev = v; ++seen; });
+        assert(ordered && seen == tree.GetLength());
+        while (tree.GetLength()) assert(tree.Remove(tree.GetFirst()));
+        assert(tree.LowerBound(5) == 0);
+
+        auto sub = flat.GetSubsequence(10, 19);
+        assert(sub->GetLength() == 10 && sub->Get(0) == flat.Get(10));
+    }
+    {
+        // Добавление собственного элемента: Resize и сдвиг не портят аргумент
+        FlatSortedSequence<std::string> fs;
+        BTreeSortedSequence<std::string> ts;
+        for (char c = 'a'; c <= 'h'; ++c) {
+            fs.Add(std::string(40, c));
+            ts.Add(std::string(40, c));
+        }
+        for (int i = 0; i < 200; ++i) {
+            std::size_t k = (std::size_t)i * 7 % fs.GetLength();
+            fs.Add(std::as_const(fs)[k]);
+            ts.Add(std::as_const(ts)[k]);
+        }
+        assert(fs.GetLength() == 208 && ts.GetLength() == 208);
+        for (std::size_t i = 0; i < fs.GetLength(); ++i) {
+            assert(fs.Get(i).size() == 40 && fs.Get(i) == ts.Get(i));
+            if (i) assert(fs.Get(i - 1) <= fs.Get(i));
+        }
+    }
+    std::cout << "Тесты SortedSequence пройдены!\n";
+}
+
+void runBlockingQueueTests() {
+    {
+        BlockingQueue<int> q(3);
+        assert(q.TryEnqueue(1) && q.TryEnqueue(2) && q.TryEnqueue(3));
+        assert(!q.TryEnqueue(4));
+        assert(!q.EnqueueFor(4, std::chrono::milliseconds(5)));
+        assert(q.Dequeue() == 1);
+        int buf[8];
+        assert(q.DequeueBatch(buf, 8) == 2 && buf[0] == 2 && buf[1] == 3);
+        int v;
+        assert(!q.TryDequeue(v));
+        assert(!q.DequeueFor(v, std::chrono::milliseconds(5)));
+        q.Close();
+        assert(q.DequeueBatch(buf, 8) == 0);
+        bool caught = false;
+        try { q.Enqueue(5); } catch (const std::logic_error&) { caught = true; }
+        assert(caught);
+    }
+    {
+        // Пакеты из списка и в список, с переходом через конец кольца
+        int arr[] = {1, 2, 3};
+        MutableListSequence<int> src(arr, 3);
+        BlockingQueue<int> q(4);
+        assert(q.TryEnqueue(0) && q.TryEnqueue(0) && q.TryEnqueue(0));
+        MutableListSequence<int> sink;
+        assert(q.DequeueBatch(sink, 2) == 2);
+        assert(q.EnqueueBatch(src) == 3);
+        assert(q.DequeueBatch(sink, 8) == 4 && sink.GetLength() == 6 && sink.GetLast() == 3);
+        // Забранные элементы не удерживаются кольцом
+        BlockingQueue<std::shared_ptr<int>> owners(2);
+        auto p = std::make_shared<int>(7);
+        owners.Enqueue(p);
+        MutableArraySequence<std::shared_ptr<int>> taken;
+        assert(owners.DequeueBatch(taken, 2) == 1 && p.use_count() == 2);
+    }
+    {
+        const int N = 20000;
+        BlockingQueue<int> q(16);
+        std::thread producer([&]{
+            int chunk[7];
+            for (int i = 0; i < N; i += 7) {
+                int n = 0;
+                for (int j = i; j < i + 7 && j < N; ++j) chunk[n++] = j;
+                q.EnqueueBatch(chunk, (std::size_t)n);
+            }
+            q.Close();
+        });
+        MutableArraySequence<int> got;
+        while (q.DequeueBatch(got, 5) > 0) {}
+        producer.join();
+        assert(got.GetLength() == (std::size_t)N);
+        for (int i = 0; i < N; ++i) assert(got.Get(i) == i);
+    }
+    std::cout << "Тесты BlockingQueue пройдены!\n";
+}
+
+void benchPipeline() {
+    const std::size_t N = 1000000;
+    using Clock = std::chrono::steady_clock;
+    std::cout << "Элементов: " << N << ", ёмкость очереди 1024\n";
+
+    for (std::size_t batch : {1, 16, 256}) {
+        BlockingQueue<long long> q(1024);
+        auto t0 = Clock::now();
+        std::thread producer([&]{
+            DynamicArray<long long> buf(batch);
+            for (std::size_t i = 0; i < N; i += batch) {
+                std::size_t n = N - i < batch ? N - i : batch;
+                for (std::size_t j = 0; j < n; ++j)
+                    buf[j] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 Clock::now().time_since_epoch()).count();
+                q.EnqueueBatch(buf.Data(), n);
+            }
+            q.Close();
+        });
+        DynamicArray<long long> buf(batch);
+        long long latSum = 0, latMax = 0;
+        std::size_t got = 0, n;
+        while ((n = q.DequeueBatch(buf.Data(), batch)) > 0) {
+            long long now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                Clock::now().time_since_epoch()).count();
+            for (std::size_t j = 0; j < n; ++j) {
+                long long lat = now - buf[j];
+                latSum += lat;
+                if (lat > latMax) latMax = lat;
+            }
+            got += n;
+        }
+        producer.join();
+        double sec = std::chrono::duration<double>(Clock::now() - t0).count();
+        std::cout << "Пакет " << batch << ": " << (long long)(got / sec) << " эл/с, задержка средняя "
+                  << latSum / (long long)got / 1000 << " us, максимальная " << latMax / 1000 << " us\n";
+    }
+}
+
+void runPriorityQueueTests() {
+    {
+        int arr[] = {9, 4, 7, 1, 8, 2, 2, 6};
+        MutableArraySequence<int> src(arr, 8);
+        PriorityQueue<int, 2> bin(src);
+        MutableListSequence<int> lsrc(arr, 8);
+        PriorityQueue<int, 8> oct(lsrc);   // из списка — одним проходом ForEach
+        PriorityQueue<int, 4, std::greater<int>> maxHeap(arr, 8);
+        int prev = -1;
+        while (!bin.IsEmpty()) {
+            int v = bin.Pop();
+            assert(v >= prev && v == oct.Pop());
+            prev = v;
+        }
+        assert(maxHeap.Top() == 9);
+        maxHeap.Push(100);
+        assert(maxHeap.Pop() == 100 && maxHeap.Pop() == 9);
+        bool caught = false;
+        try { bin.Top(); } catch (const std::out_of_range&) { caught = true; }
+        assert(caught);
+    }
+    {
+        std::size_t x = 12345;
+        auto rnd = [&]{
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            return x;
+        };
+        PriorityQueue<int, 4> pq;
+        for (int i = 0; i < 5000; ++i) pq.Push((int)(rnd() % 10000));
+        int prev = -1;
+        while (pq.GetLength()) {
+            int v = pq.Pop();
+            assert(v >= prev);
+            prev = v;
+        }
+    }
+    {
+        IndexedPriorityQueue<int, 4> ipq;
+        auto a = ipq.Push(50);
+        auto b = ipq.Push(30);
+        auto c = ipq.Push(40);
+        auto d = ipq.Push(60);
+        assert(ipq.TopHandle() == b);
+        ipq.DecreaseKey(d, 10);
+        assert(ipq.TopHandle() == d && ipq.Top() == 10);
+        ipq.Erase(c);
+        assert(!ipq.Contains(c) && ipq.GetLength() == 3);
+        ipq.Update(d, 100);
+        assert(ipq.Pop() == 30 && ipq.Pop() == 50 && ipq.Pop() == 100);
+        assert(ipq.IsEmpty() && !ipq.Contains(a));
+        bool caught = false;
+        try { ipq.DecreaseKey(a, 1); } catch (const std::out_of_range&) { caught = true; }
+        assert(caught);
+    }
+    {
+        // Долгий цикл Push/Pop: дескрипторы переиспользуются, снятые значения освобождаются
+        IndexedPriorityQueue<int, 2> ipq;
+        std::size_t maxHandle = 0;
+        for (int i = 0; i < 100000; ++i) {
+            auto h = ipq.Push(i % 97);
+            maxHandle = std::max<std::size_t>(maxHandle, h);
+            if (ipq.GetLength() > 8) ipq.Pop();
+        }
+        assert(maxHandle < 9 && ipq.GetLength() == 8);
+
+        auto byValue = [](const std::shared_ptr<int>& x, const std::shared_ptr<int>& y) { return *x < *y; };
+        IndexedPriorityQueue<std::shared_ptr<int>, 4, decltype(byValue)> owners(byValue);
+        auto payload = std::make_shared<int>(5);
+        auto h = owners.Push(payload);
+        owners.Push(std::make_shared<int>(1));
+        owners.Pop();
+        owners.Erase(h);
+        assert(payload.use_count() == 1);
+        auto again = owners.Push(payload);
+        assert(owners.Contains(again) && *owners.Get(again) == 5);
+    }
+    std::cout << "Тесты PriorityQueue пройдены!\n";
+}
+
+template<std::size_t D>
+static void benchOneArity(std::size_t n) {
+    using Clock = std::chrono::high_resolution_clock;
+    std::size_t x = 88172645463325252ULL;
+    DynamicArray<int> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        data[i] = (int)(x >> 33);
+    }
+    auto t0 = Clock::now();
+    PriorityQueue<int, D> pq;
+    for (std::size_t i = 0; i < n; ++i) pq.Push(data[i]);
+    auto t1 = Clock::now();
+    long long sum = 0;
+    while (!pq.IsEmpty()) sum += pq.Pop();
+    auto t2 = Clock::now();
+    PriorityQueue<int, D> built(data.Data(), n);
+    auto t3 = Clock::now();
+    auto ms = [](auto a, auto b){
+        return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count();
+    };
+    std::cout << "d = " << D << ": Push " << ms(t0, t1) << " ms, Pop " << ms(t1, t2)
+              << " ms, Heapify " << ms(t2, t3) << " ms (сумма " << sum + built.Top() << ")\n";
+}
+
+void benchHeapArity() {
+    const std::size_t N = 2000000;
+    std::cout << "Элементов: " << N << "\n";
+    benchOneArity<2>(N);
+    benchOneArity<4>(N);
+    benchOneArity<8>(N);
+}
+
+void runDequeTests() {
+    {
+        // Эталон — MutableArraySequence, где снятые спереди элементы пропускаются через front
+        DequeArraySequence<int> d;
+        MutableArraySequence<int> ref;
+        std::size_t front = 0;
+        std::size_t x = 777;
+        for (int step = 0; step < 4000; ++step) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            int op = (int)(x % 6);
+            std::size_t len = ref.GetLength() - front;
+            if (op == 0) { d.Append(step); ref.Append(step); }
+            else if (op == 1) { d.Prepend(step); ref.InsertAt(step, front); }
+            else if (op == 2) {
+                std::size_t idx = (x >> 8) % (len + 1);
+                d.InsertAt(step, idx); ref.InsertAt(step, front + idx);
+            }
+            else if (op == 3 && len) { assert(d.PopFront() == ref.Get(front)); ++front; }
+            else { d.Append(-step); ref.Append(-step); }
+        }
+        assert(d.GetLength() == ref.GetLength() - front);
+        for (std::size_t i = 0; i < d.GetLength(); ++i) assert(d[i] == ref[front + i]);
+    }
+    {
+        DequeArraySequence<std::string> d;
+        d.Append("b"); d.Prepend("a"); d.Append("c");
+        assert(d.GetFirst() == "a" && d.GetLast() == "c");
+        assert(d.PopBack() == "c" && d.PopFront() == "a" && d.PopFront() == "b");
+        bool caught = false;
+        try { d.PopFront(); } catch (const std::out_of_range&) { caught = true; }
+        assert(caught);
+
+        const Sequence<std::string>& s = d;
+        auto imm = s.Prepend(std::string("z"));
+        assert(imm->GetLength() == 1 && d.GetLength() == 0);
+        for (int i = 0; i < 100; ++i) { d.Prepend("p"); d.PopBack(); }
+        assert(d.GetLength() == 0);
+    }
+    {
+        // Аргумент из самого дека: переживает regrow и сдвиг при вставке
+        DequeArraySequence<std::string> d;
+        MutableArraySequence<std::string> ref;
+        d.Append(std::string(40, 'a')); ref.Append(std::string(40, 'a'));
+        d.Append(std::string(40, 'b')); ref.Append(std::string(40, 'b'));
+        for (int i = 0; i < 40; ++i) {
+            std::size_t k = (std::size_t)i % d.GetLength();
+            std::string v = ref.Get(k);
+            d.Append(std::as_const(d)[k]); ref.Append(v);
+            d.Prepend(std::as_const(d)[k]); ref.Prepend(v);
+            std::size_t at = d.GetLength() / 3;
+            v = ref.Get(d.GetLength() - 1);
+            d.InsertAt(std::as_const(d)[d.GetLength() - 1], at); ref.InsertAt(v, at);
+        }
+        d.AppendRange(&std::as_const(d)[0], d.GetLength());
+        ref.AppendRange(&std::as_const(ref)[0], ref.GetLength());
+        assert(d.GetLength() == ref.GetLength());
+        for (std::size_t i = 0; i < d.GetLength(); ++i) assert(d.Get(i) == ref.Get(i));
+    }
+    std::cout << "Тесты DequeArraySequence пройдены!\n";
+}
+
+void benchPrepend() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto bench = [&](const char* label, std::size_t n, auto make){
+        auto t0 = Clock::now();
+        auto seq = make();
+        for (std::size_t i = 0; i < n; ++i) seq.Prepend((int)i);
+        auto t1 = Clock::now();
+        std::cout << label << ", " << n << " Prepend: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << " ms\n";
+    };
+    bench("MutableArraySequence", 20000, []{ return MutableArraySequence<int>(); });
+    bench("DequeArraySequence", 20000, []{ return DequeArraySequence<int>(); });
+    bench("DequeArraySequence", 2000000, []{ return DequeArraySequence<int>(); });
+}
+
+void runGapBufferTests() {
+    {
+        const char* text = "helo world";
+        GapBufferSequence<char> g(text, 10);
+        g.InsertAt('l', 3);
+        assert(g.GetCursor() == 4);
+        g.MoveCursor(11);
+        g.Insert('!');
+        g.MoveCursor(5);
+        assert(g.DeleteAfter() == ' ');
+        g.Insert('_');
+        std::string out;
+        for (std::size_t i = 0; i < g.GetLength(); ++i) out += g.Get(i);
+        assert(out == "hello_world!");
+        assert(g.DeleteBefore() == '_' && g.RemoveAt(0) == 'h');
+        assert(g.GetFirst() == 'e' && g.GetLast() == '!');
+        auto sub = g.GetSubsequence(0, 3);
+        assert(sub->GetLength() == 4 && sub->Get(3) == 'o');
+    }
+    {
+        GapBufferSequence<int> g;
+        MutableArraySequence<int> ref;
+        std::size_t x = 4242, cursor = 0;
+        for (int step = 0; step < 3000; ++step) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            if (x % 5 == 0) cursor = (x >> 8) % (ref.GetLength() + 1);
+            if (x % 7 == 0 && cursor < ref.GetLength()) {
+                assert(g.RemoveAt(cursor) == ref.Get(cursor));
+                auto rest = Slice<int>(ref, (int)cursor, 1);
+                ref = MutableArraySequence<int>();
+                for (std::size_t i = 0; i < rest->GetLength(); ++i) ref.Append(rest->Get(i));
+            } else {
+                g.InsertAt(step, cursor);
+                ref.InsertAt(step, cursor);
+                ++cursor;
+            }
+        }
+        assert(g.GetLength() == ref.GetLength());
+        for (std::size_t i = 0; i < g.GetLength(); ++i) assert(g[i] == ref[i]);
+    }
+    {
+        // Аргумент из самого буфера: переживает перенос курсора и grow
+        GapBufferSequence<std::string> g;
+        MutableArraySequence<std::string> ref;
+        for (char c : std::string("abcd")) {
+            g.Append(std::string(40, c)); ref.Append(std::string(40, c));
+        }
+        g.MoveCursor(0);
+        g.InsertAt(std::as_const(g)[0], 3); ref.InsertAt(ref.Get(0), 3);
+        for (int i = 0; i < 40; ++i) {
+            std::size_t k = (std::size_t)i % g.GetLength();
+            std::string v = ref.Get(k);
+            g.Append(std::as_const(g)[k]); ref.Append(v);
+            g.Prepend(std::as_const(g)[k]); ref.Prepend(v);
+            g.MoveCursor(k);
+            g.Insert(std::as_const(g)[g.GetLength() - 1]); ref.InsertAt(ref.Get(ref.GetLength() - 1), k);
+        }
+        std::size_t head = g.GetCursor();   // [0, курсор) лежит в буфере подряд
+        g.AppendRange(&std::as_const(g)[0], head);
+        ref.AppendRange(&std::as_const(ref)[0], head);
+        assert(g.GetLength() == ref.GetLength());
+        for (std::size_t i = 0; i < g.GetLength(); ++i) assert(g.Get(i) == ref.Get(i));
+    }
+    std::cout << "Тесты GapBufferSequence пройдены!\n";
+}
+
+void benchGapBuffer() {
+    using Clock = std::chrono::high_resolution_clock;
+    const std::size_t base = 100000, edits = 20000;
+    auto bench = [&](const char* label, Sequence<int>& seq){
+        for (std::size_t i = 0; i < base; ++i) seq.Append((int)i);
+        std::size_t cursor = base / 2;
+        auto t0 = Clock::now();
+        for (std::size_t i = 0; i < edits; ++i) {
+            seq.InsertAt((int)i, cursor);
+            cursor += (i % 16 == 0) ? 3 : 1;
+        }
+        auto t1 = Clock::now();
+        std::cout << label << ": " << edits << " вставок рядом с курсором в " << base
+                  << " элементов — "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << " ms\n";
+    };
+    MutableArraySequence<int> arr{DynamicArray<int>(0)};
+    GapBufferSequence<int> gap;
+    bench("MutableArraySequence", arr);
+    bench("GapBufferSequence", gap);
+}
+
+// Проверки на этапе компиляции: всё вычисляется constexpr
+constexpr int fixedSquaresSum() {
+    FixedArraySequence<int, 8> s{1, 2, 3, 4};
+    auto sq = Map<int, int>(s, [](int x) { return x * x; });
+    return Reduce<int, int>(sq, 0, [](int a, int b) { return a + b; });
+}
+static_assert(fixedSquaresSum() == 30);
+static_assert(Where<int>(FixedArraySequence<int, 6>{1, 2, 3, 4, 5, 6},
+                         [](int x) { return x % 2 == 0; }).GetLength() == 3);
+static_assert(ContainsSubsequence<int>(FixedArraySequence<int, 5>{1, 2, 3, 4, 5},
+                                       FixedArraySequence<int, 2>{3, 4}));
+static_assert(Split<int>(FixedArraySequence<int, 5>{1, 0, 2, 3, 0},
+                         [](int x) { return x == 0; }).GetLength() == 3);
+
+void runFixedArrayTests() {
+    {
+        FixedArraySequence<int, 4> s;
+        s.Append(2);
+        s.Append(3);
+        s.Prepend(1);
+        assert(s.GetLength() == 3 && s.GetFirst() == 1 && s.GetLast() == 3);
+        s.InsertAt(9, 1);
+        assert(s.IsFull() && s[1] == 9 && s[3] == 3);
+        bool threw = false;
+        try { s.Append(5); } catch (const std::length_error&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { s.Get(4); } catch (const std::out_of_range&) { threw = true; }
+        assert(threw);
+        auto sub = s.GetSubsequence(1, 2);
+        assert(sub.GetLength() == 2 && sub[0] == 9 && sub[1] == 2);
+    }
+    {
+        FixedArraySequence<int, 5> a{1, 2, 3, 4, 5};
+        FixedArraySequence<char, 3> b{'a', 'b', 'c'};
+        auto z = Zip<int, char>(a, b);
+        static_assert(decltype(z)::Capacity() == 3);
+        assert(z.GetLength() == 3 && z[2].first == 3 && z[2].second == 'c');
+        auto uz = Unzip<int, char>(z);
+        assert(uz.first.GetLength() == 3 && uz.second[1] == 'b');
+        auto sl = Slice<int>(a, 1, 2, FixedArraySequence<int, 1>{7});
+        assert(sl.GetLength() == 4 && sl[0] == 1 && sl[1] == 7 && sl[2] == 4);
+        auto fm = FlatMap<int, int>(a, [](int x) { return FixedArraySequence<int, 2>{x, -x}; });
+        assert(fm.GetLength() == 10 && fm[3] == -2);
+        assert(Find<int>(a, [](int x) { return x > 3; }) == 4);
+        int out = 0;
+        assert(!TryFind<int>(a, [](int x) { return x > 5; }, out));
+    }
+    {
+        // Через адаптер FixedArraySequence работает с обычными алгоритмами
+        FixedArraySequence<int, 16> s{5, 6, 7};
+        auto view = AsSequence(s);
+        Sequence<int>& seq = view;
+        seq.Append(8);
+        assert(s.GetLength() == 4 && s[3] == 8);
+        auto mapped = Map<int, int>(seq, [](const int& x) { return x + 1; });
+        assert(mapped->GetLength() == 4 && mapped->Get(0) == 6);
+        auto cl = seq.Clone();
+        cl->Append(9);
+        assert(cl->GetLength() == 5 && s.GetLength() == 4);
+        const Sequence<int>& cseq = view;
+        auto pre = cseq.Prepend(4);
+        assert(pre->GetFirst() == 4 && seq.GetFirst() == 5);
+    }
+    std::cout << "Тесты FixedArraySequence пройдены!\n";
+}
+
+void runZippedTests() {
+    {
+        int a[] = {1, 2, 3, 4};
+        MutableArraySequence<int> xs(a, 4);
+        MutableArraySequence<std::string> ys;
+        ys.Append("one"); ys.Append("two"); ys.Append("three");
+        auto z = ZipView(xs, ys);
+        assert(z.GetLength() == 3);
+        assert(z.Get(1).first == 2 && z.Get(1).second == "two");
+        xs[0] = 10;  // представление видит изменения источника
+        assert(z.GetFirst().first == 10);
+        auto sub = z.GetSubsequence(1, 2);
+        assert(sub->GetLength() == 2 && sub->GetLast().second == "three");
+        const Sequence<std::pair<int, std::string>>& cz = z;
+        auto ext = cz.Append({5, "five"});
+        assert(ext->GetLength() == 4 && ext->GetLast().first == 5);
+        bool threw = false;
+        try { z.Append(std::pair<int, std::string>(0, "")); } catch (const std::logic_error&) { threw = true; }
+        assert(threw);
+        int sum = 0;
+        for (auto p : z) sum += p.first;
+        assert(sum == 15);
+        auto copied = Zip<int, std::string>(xs, ys);
+        for (std::size_t i = 0; i < z.GetLength(); ++i) assert(copied->Get(i) == cz.Get(i));
+        threw = false;
+        try { (void)cz[0]; } catch (const std::logic_error&) { threw = true; }
+        assert(threw);
+    }
+    {
+        int a[] = {1, 2, 3};
+        double b[] = {0.5, 1.5, 2.5};
+        MutableArraySequence<int> xs(a, 3);
+        MutableArraySequence<double> ys(b, 3);
+        PairSequence<int, double> ps(xs, ys);
+        ps.Append({4, 3.5});
+        ps.Prepend({0, -0.5});
+        assert(ps.GetLength() == 5 && ps.GetFirst().first == 0 && ps.GetLast().second == 3.5);
+        ps.First(2) = 20;
+        ps.Set(3, {30, 30.5});
+        assert(ps.Get(2).first == 20 && ps.Get(3).second == 30.5);
+        long firsts = Reduce<int, long>(ps.Firsts(), 0L, [](const long& acc, const int& v) { return acc + v; });
+        assert(firsts == 0 + 1 + 20 + 30 + 4);
+        auto cols = UnzipView(ps);
+        assert(&cols.first == &ps.Firsts() && cols.second.Get(1) == 0.5);
+        const Sequence<std::pair<int, double>>& cps = ps;
+        auto cl = cps.InsertAt({7, 7.5}, 1);
+        assert(cl->GetLength() == 6 && cl->Get(1).first == 7 && ps.GetLength() == 5);
+        bool threw = false;
+        try { (void)cps[0]; } catch (const std::logic_error&) { threw = true; }
+        assert(threw);
+        PairSequence<int, double> back(*Zip<int, double>(xs, ys));
+        assert(back.GetLength() == 3 && back.Get(2).second == 2.5);
+    }
+    std::cout << "Тесты ZippedSequence/PairSequence пройдены!\n";
+}
+
+void benchColumns() {
+    using Clock = std::chrono::high_resolution_clock;
+    const std::size_t n = 2000000;
+    struct Payload { double w[6]; };
+    DynamicArray<std::pair<int, Payload>> rows(n);
+    DynamicArray<int> keyCol(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        rows[i].first = (int)(i % 1000);
+        keyCol[i] = (int)(i % 1000);
+    }
+    MutableArraySequence<std::pair<int, Payload>> aos(std::move(rows));
+    MutableArraySequence<int> keys(std::move(keyCol));
+    MutableArraySequence<Payload> payload{DynamicArray<Payload>(n)};
+    PairSequence<int, Payload> soa(keys, payload);
+    auto time = [](auto&& f) {
+        auto t0 = Clock::now();
+        long r = f();
+        auto t1 = Clock::now();
+        return std::make_pair(r, std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count());
+    };
+    auto a = time([&] {
+        long acc = 0;
+        for (std::size_t i = 0; i < n; ++i) acc += aos[i].first;
+        return acc;
+    });
+    auto b = time([&] {
+        const auto& firsts = soa.Firsts();
+        long acc = 0;
+        for (std::size_t i = 0; i < n; ++i) acc += firsts[i];
+        return acc;
+    });
+    assert(a.first == b.first);
+    std::cout << "Сумма .first по " << n << " парам:\n"
+              << "  массив пар:    " << a.second << " ms\n"
+              << "  PairSequence:  " << b.second << " ms\n";
+}
+
+void runCowTests() {
+    {
+        int a[] = {1, 2, 3, 4};
+        MutableArraySequence<int> s(a, 4);
+        auto cl = s.Clone();
+        auto& cs = static_cast<MutableArraySequence<int>&>(*cl);
+        assert(s.GetStorage().UseCount() == 2);
+        assert(std::as_const(s).GetStorage().Data() == std::as_const(cs).GetStorage().Data());
+        cs[0] = 10;  // первая запись отделяет буфер
+        assert(!s.GetStorage().IsShared() && s.Get(0) == 1 && cs.Get(0) == 10);
+        auto cl2 = s.Clone();
+        s.Append(5);
+        assert(s.GetLength() == 5 && cl2->GetLength() == 4 && cl2->GetLast() == 4);
+    }
+    {
+        int a[] = {1, 2, 3};
+        const ImmutableArraySequence<int> src(a, 3);
+        auto app = src.Append(4);
+        auto pre = src.Prepend(0);
+        auto ins = src.InsertAt(9, 1);
+        auto cat = src.Concat(app.get());
+        assert(app->GetLength() == 4 && app->GetLast() == 4);
+        assert(pre->GetFirst() == 0 && pre->Get(3) == 3);
+        assert(ins->Get(1) == 9 && ins->Get(2) == 2);
+        assert(cat->GetLength() == 7 && cat->Get(3) == 1);
+        assert(src.GetLength() == 3 && src.Get(1) == 2);
+        bool threw = false;
+        try { src.InsertAt(1, 5); } catch (const std::out_of_range&) { threw = true; }
+        assert(threw);
+    }
+    {
+        // Параллельные клоны и чтение общего буфера
+        MutableArraySequence<int> s{DynamicArray<int>(1000)};
+        for (std::size_t i = 0; i < 1000; ++i) s[i] = (int)i;
+        std::thread ts[4];
+        long sums[4] = {};
+        for (int t = 0; t < 4; ++t) {
+            ts[t] = std::thread([&, t] {
+                for (int k = 0; k < 200; ++k) {
+                    auto cl = s.Clone();
+                    sums[t] += cl->Get((std::size_t)k);
+                    if (k % 50 == 0) (*cl)[0] = -1;
+                }
+            });
+        }
+        for (auto& t : ts) t.join();
+        for (long v : sums) assert(v == 199L * 200 / 2);
+        assert(s.GetStorage().UseCount() == 1 && s.Get(0) == 0);
+    }
+    std::cout << "Тесты копирования при записи пройдены!\n";
+}
+
+void benchCow() {
+    using Clock = std::chrono::high_resolution_clock;
+    const std::size_t n = 100000, clones = 5000;
+    auto bench = [&](const char* label, const Sequence<int>& src) {
+        auto t0 = Clock::now();
+        long acc = 0;
+        for (std::size_t k = 0; k < clones; ++k) {
+            auto cl = src.Clone();
+            acc += cl->Get(k % n) + cl->GetLast();
+        }
+        auto t1 = Clock::now();
+        std::cout << label << ": " << clones << " Clone + чтение по " << n << " элементов — "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+                  << " ms (" << acc << ")\n";
+    };
+    DynamicArray<int> raw(n);
+    for (std::size_t i = 0; i < n; ++i) raw[i] = (int)i;
+    MutableArraySequence<int, DynamicArray<int>> deep{DynamicArray<int>(raw)};
+    MutableArraySequence<int> cow{DynamicArray<int>(raw)};
+    bench("DynamicArray (глубокая копия)", deep);
+    bench("CowArray", cow);
+
+    auto t0 = Clock::now();
+    const ImmutableArraySequence<int> imm(raw.Data(), n);
+    long acc = 0;
+    for (std::size_t k = 0; k < 200; ++k) {
+        auto next = imm.Append((int)k);
+        acc += next->GetLast();
+    }
+    auto t1 = Clock::now();
+    std::cout << "ImmutableArraySequence::Append x200: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+              << " ms (" << acc << ")\n";
+}
+
+void runPolicyArrayTests() {
+    {
+        DynamicArray<int, ExactGrowth> exact;
+        DynamicArray<int> doubling;
+        for (int i = 0; i < 100; ++i) {
+            exact.Resize(exact.GetSize() + 1);
+            doubling.Resize(doubling.GetSize() + 1);
+            exact[i] = doubling[i] = i;
+        }
+        assert(exact.GetCapacity() == 100 && doubling.GetCapacity() == 128);
+        doubling.Resize(10);
+        assert(doubling.GetSize() == 10 && doubling.GetCapacity() == 128 && doubling.Get(9) == 9);
+        doubling.ShrinkToFit();
+        assert(doubling.GetCapacity() == 10 && doubling[9] == 9);
+        bool threw = false;
+        try { doubling.Get(10); } catch (const std::out_of_range&) { threw = true; }
+        assert(threw);
+    }
+    {
+        DynamicArray<double, DoublingGrowth, CheckedBounds, AlignedAllocator<64>> al(3);
+        assert(reinterpret_cast<std::uintptr_t>(al.Data()) % 64 == 0);
+        al.Resize(1000);
+        assert(reinterpret_cast<std::uintptr_t>(al.Data()) % 64 == 0 && al[999] == 0.0);
+        DynamicArray<char, DoublingGrowth, CheckedBounds, HugePageAllocator> huge(std::size_t(1) << 21);
+        assert(reinterpret_cast<std::uintptr_t>(huge.Data()) % HugePageAllocator::kHugePage == 0);
+    }
+    {
+        // Нетривиальные элементы: конструируются только [0, size)
+        DynamicArray<std::string> strs{"a", "b"};
+        strs.Reserve(64);
+        strs.Resize(3);
+        assert(strs.GetCapacity() == 64 && strs[2].empty() && strs[1] == "b");
+        DynamicArray<std::string> copy = strs;
+        copy.Resize(1);
+        assert(copy.GetSize() == 1 && strs.GetSize() == 3);
+    }
+    {
+        PolicyArraySequence<int, DoublingGrowth, UncheckedBounds, AlignedAllocator<64>> seq;
+        for (int i = 0; i < 1000; ++i) seq.Append(i);
+        seq.InsertAt(-1, 0);
+        assert(seq.GetLength() == 1001 && seq[0] == -1 && seq.GetLast() == 999);
+        auto cl = seq.Clone();
+        assert(cl->Get(500) == 499);
+        auto mapped = Map<int, int>(seq, [](const int& x) { return x * 2; });
+        assert(mapped->Get(1000) == 1998);
+    }
+    std::cout << "Тесты политик DynamicArray пройдены!\n";
+}
+
+void benchPolicies() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](auto d) { return std::chrono::duration_cast<std::chrono::milliseconds>(d).count(); };
+    const std::size_t appends = 100000;
+    auto grow = [&](const char* label, auto&& seq) {
+        auto t0 = Clock::now();
+        for (std::size_t i = 0; i < appends; ++i) seq.Append((int)i);
+        std::cout << label << ": " << appends << " Append — " << ms(Clock::now() - t0) << " ms\n";
+    };
+    grow("ExactGrowth   ", PolicyArraySequence<int, ExactGrowth>());
+    grow("DoublingGrowth", PolicyArraySequence<int, DoublingGrowth>());
+
+    const std::size_t n = 1 << 22, passes = 20;
+    auto scan = [&](const char* label, auto& arr) {
+        auto t0 = Clock::now();
+        long acc = 0;
+        for (std::size_t p = 0; p < passes; ++p)
+            for (std::size_t i = 0; i < n; ++i) acc += arr[i];
+        std::cout << label << ": " << passes << " проходов по " << n << " — "
+                  << ms(Clock::now() - t0) << " ms (" << acc << ")\n";
+    };
+    DynamicArray<int, DoublingGrowth, CheckedBounds> checked(n);
+    DynamicArray<int, DoublingGrowth, UncheckedBounds, AlignedAllocator<64>> unchecked(n);
+    for (std::size_t i = 0; i < n; ++i) checked[i] = unchecked[i] = (int)(i & 1023);
+    scan("CheckedBounds  ", checked);
+    scan("UncheckedBounds", unchecked);
+}
+
+void runCoroutineTests() {
+    {
+        int a[] = {1, 2, 3, 4, 5, 6};
+        MutableArraySequence<int> src(a, 6);
+        auto squares = Map<int, int>(FromSequence<int>(src), [](int x) { return x * x; });
+        auto even = Where<int>(std::move(squares), [](int x) { return x % 2 == 0; });
+        MutableArraySequence<int> out;
+        assert(CollectInto<int>(std::move(even), out) == 3);
+        assert(out.Get(0) == 4 && out.Get(2) == 36);
+        long sum = Reduce<int, long>(Take<int>(FromSequence<int>(src), 4), 0L,
+                                     [](long acc, int v) { return acc + v; });
+        assert(sum == 10);
+        int n = 0;
+        for (int v : FromSequence<int>(src)) n += v;
+        assert(n == 21);
+        // Списки читаются итератором по узлам
+        MutableListSequence<int> lsrc(a, 6);
+        PooledListSequence<int> psrc(a, 6);
+        n = 0;
+        for (int v : FromSequence<int>(lsrc)) n = n * 10 + v;
+        for (int v : FromSequence(psrc)) n += v;
+        assert(n == 123456 + 21);
+    }
+    {
+        // Генератор как читатель: файл -> ленивые стадии -> очередь
+        std::istringstream in("5 8 13 21 34 55");
+        NumberReader<int> r(in);
+        auto odd = Where<int>(FromReader(r), [](int x) { return x % 2 != 0; });
+        QueueSequence<int> q;
+        assert(ReadInto(odd, q, 2) == 4);
+        assert(q.Dequeue() == 5 && q.Dequeue() == 13);
+        auto rest = Drain(q);
+        int v = 0;
+        assert(rest.Next(v) && v == 21 && rest.Next(v) && v == 55 && !rest.Next(v));
+        assert(q.GetLength() == 0);
+    }
+    {
+        QueueSequence<int> empty;
+        auto none = Map<int, int>(Take<int>(Drain(empty), 1), [](int x) { return x; });
+        int v = 0;
+        assert(!none.Next(v));
+        MutableArraySequence<int> src;
+        src.Append(1); src.Append(0);
+        auto div = Map<int, int>(FromSequence<int>(src), [](int x) {
+            if (x == 0) throw std::domain_error("zero");
+            return 10 / x;
+        });
+        bool threw = false;
+        assert(div.Next(v) && v == 10);
+        try { div.Next(v); } catch (const std::domain_error&) { threw = true; }
+        assert(threw);
+    }
+    {
+        // Асинхронный конвейер: маленькие очереди заставляют стадии ждать друг друга
+        MutableArraySequence<int> src;
+        for (int i = 0; i < 1000; ++i) src.Append(i);
+        EventLoop loop;
+        AsyncQueue<int> q1(loop, 4), q2(loop, 0), q3(loop, 2);
+        MutableArraySequence<int> sink;
+        loop.Spawn(SinkStage(q3, sink));
+        loop.Spawn(WhereStage(q2, q3, [](const int& x) { return x % 3 == 0; }));
+        loop.Spawn(MapStage(q1, q2, [](const int& x) { return x * 2; }));
+        loop.Spawn(ProduceStage(FromSequence<int>(src), q1));
+        assert(loop.Run());
+        assert(sink.GetLength() == 334 && sink.Get(1) == 6 && sink.GetLast() == 1998);
+        for (std::size_t i = 1; i < sink.GetLength(); ++i) assert(sink.Get(i) > sink.Get(i - 1));
+    }
+    {
+        EventLoop loop;
+        AsyncQueue<int> q(loop, 1);
+        long acc = 0;
+        loop.Spawn(ReduceStage(q, acc, [](long a, int v) { return a + v; }));
+        assert(!loop.Run() && loop.GetLiveTasks() == 1);  // потребитель ждёт данных
+        q.Close();
+        assert(loop.Run() && acc == 0);
+    }
+    {
+        // Незавершённые задачи уничтожает цикл: ждущий незакрытой очереди приёмник
+        // и задачи, брошенные после исключения в Run
+        EventLoop loop;
+        AsyncQueue<int> q(loop, 1), q2(loop, 1);
+        MutableArraySequence<int> sink;
+        loop.Spawn(SinkStage(q, sink));
+        loop.Spawn(MapStage(q2, q, [](const int& x) {
+            if (x > 1) throw std::domain_error("stage");
+            return x;
+        }));
+        assert(!loop.Run() && loop.GetLiveTasks() == 2);
+        MutableArraySequence<int> src;
+        for (int i = 1; i <= 3; ++i) src.Append(i);
+        bool threw = false;
+        loop.Spawn(ProduceStage(FromSequence<int>(src), q2));
+        try { loop.Run(); } catch (const std::domain_error&) { threw = true; }
+        assert(threw && loop.GetLiveTasks() == 2 && sink.GetLength() <= 1);
+    }
+    std::cout << "Тесты генераторов и асинхронного конвейера пройдены!\n";
+}
+
+void benchCoroutines() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](auto d) { return std::chrono::duration_cast<std::chrono::milliseconds>(d).count(); };
+    const std::size_t n = 2000000;
+    MutableArraySequence<int> src{DynamicArray<int>(n)};
+    for (std::size_t i = 0; i < n; ++i) src[i] = (int)(i % 1000);
+    auto triple = [](const int& x) { return x * 3; };
+    auto even = [](const int& x) { return x % 2 == 0; };
+    auto add = [](const long& a, const int& v) { return a + v; };
+
+    auto t0 = Clock::now();
+    auto mapped = Map<int, int>(src, triple);
+    auto filtered = Where<int>(*mapped, even);
+    long eager = Reduce<int, long>(*filtered, 0L, add);
+    auto t1 = Clock::now();
+    long lazy = Reduce<int, long>(Where<int>(Map<int, int>(FromSequence<int>(src), triple), even), 0L, add);
+    auto t2 = Clock::now();
+    long piped = 0;
+    {
+        EventLoop loop;
+        AsyncQueue<int> q1(loop, 1024), q2(loop, 1024);
+        loop.Spawn(ProduceStage(Map<int, int>(FromSequence<int>(src), triple), q1));
+        loop.Spawn(WhereStage(q1, q2, even));
+        loop.Spawn(ReduceStage(q2, piped, add));
+        bool done = loop.Run();
+        assert(done);
+    }
+    auto t3 = Clock::now();
+    assert(eager == lazy && lazy == piped);
+    std::cout << "Map(*3) -> Where(чётные) -> Reduce по " << n << " элементам:\n"
+              << "  algorithms.hpp (промежуточные массивы " << mapped->GetLength() << " + "
+              << filtered->GetLength() << "): " << ms(t1 - t0) << " ms\n"
+              << "  генераторы (без промежуточных):  " << ms(t2 - t1) << " ms\n"
+              << "  конвейер на AsyncQueue(1024):    " << ms(t3 - t2) << " ms\n";
+}
+
+// Сумма [lo, hi) делением пополам до grain элементов
+long forkJoinSum(TaskScheduler& sched, const int* a, std::size_t lo, std::size_t hi, std::size_t grain) {
+    if (hi - lo <= grain) {
+        long s = 0;
+        for (std::size_t i = lo; i < hi; ++i) s += a[i];
+        return s;
+    }
+    std::size_t mid = lo + (hi - lo) / 2;
+    long left = 0;
+    TaskGroup g(sched);
+    g.Run([&] { left = forkJoinSum(sched, a, lo, mid, grain); });
+    long right = forkJoinSum(sched, a, mid, hi, grain);
+    g.Wait();
+    return left + right;
+}
+
+void runSchedulerTests() {
+    {
+        // Каждый элемент деки достаётся ровно одному потоку
+        WorkStealingDeque<std::size_t> dq(4);
+        const std::size_t n = 100000;
+        DynamicArray<std::atomic<int>> seen(n);
+        std::atomic<bool> done{false};
+        auto thief = [&] {
+            std::size_t v;
+            while (!done.load() || dq.GetLength() > 0)
+                if (dq.Steal(v)) seen[v].fetch_add(1);
+        };
+        std::thread t1(thief), t2(thief);
+        for (std::size_t i = 0; i < n; ++i) {
+            dq.Push(i);
+            std::size_t v;
+            if (i % 3 == 0 && dq.Pop(v)) seen[v].fetch_add(1);
+        }
+        std::size_t v;
+        while (dq.Pop(v)) seen[v].fetch_add(1);
+        done = true;
+        t1.join();
+        t2.join();
+        for (std::size_t i = 0; i < n; ++i) assert(seen[i].load() == 1);
+    }
+    {
+        TaskScheduler sched(4);
+        assert(sched.GetWorkerCount() == 4);
+        std::atomic<long> sum{0};
+        for (int i = 1; i <= 1000; ++i)
+            sched.Submit([&, i] { sum.fetch_add(i); });
+        sched.Wait();
+        assert(sum.load() == 500500);
+
+        QueueSequence<std::function<void()>> work;
+        for (int i = 0; i < 100; ++i) work.Enqueue([&] { sum.fetch_add(1); });
+        sched.SubmitAll(work);
+        sched.Wait();
+        assert(work.GetLength() == 0 && sum.load() == 500600);
+
+        MutableArraySequence<int> data{DynamicArray<int>(100000)};
+        for (std::size_t i = 0; i < data.GetLength(); ++i) data[i] = (int)(i % 7);
+        const int* a = std::as_const(data).GetStorage().Data();
+        long expect = 0;
+        for (std::size_t i = 0; i < data.GetLength(); ++i) expect += a[i];
+        assert(forkJoinSum(sched, a, 0, data.GetLength(), 1000) == expect);
+
+        TaskGroup g(sched);
+        for (int i = 0; i < 10; ++i)
+            g.Run([i] { if (i == 7) throw std::runtime_error("task failed"); });
+        bool threw = false;
+        try { g.Wait(); } catch (const std::runtime_error&) { threw = true; }
+        assert(threw);
+    }
+    {
+        // Задачи после простоя будят припаркованные потоки
+        TaskScheduler sched(2);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        std::atomic<int> hits{0};
+        for (int round = 0; round < 3; ++round) {
+            sched.Submit([&] { hits.fetch_add(1); });
+            sched.Wait();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        assert(hits.load() == 3);
+    }
+    std::cout << "Тесты планировщика с кражей работы пройдены!\n";
+}
+
+void benchScheduler() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    const std::size_t n = std::size_t(1) << 25;
+    DynamicArray<int> data(n);
+    for (std::size_t i = 0; i < n; ++i) data[i] = (int)(i & 255);
+    unsigned hw = std::thread::hardware_concurrency();
+    if (hw == 0) hw = 1;
+    std::cout << "Fork-join: сумма " << n << " элементов (grain 16384)\n";
+    long base = 0;
+    for (unsigned w = 1; w <= hw; w *= 2) {
+        TaskScheduler sched(w);
+        auto t0 = Clock::now();
+        long s = forkJoinSum(sched, data.Data(), 0, n, 1 << 14);
+        auto t = us(Clock::now() - t0);
+        if (w == 1) base = t;
+        std::cout << "  потоков " << w << ": " << t / 1000.0 << " ms, ускорение "
+                  << (t ? (double)base / t : 0.0) << " (" << s << ")\n";
+    }
+    const std::size_t tasks = 500000;
+    std::cout << "Поток задач: " << tasks << " мелких задач из одной корневой задачи\n";
+    for (unsigned w = 1; w <= hw; w *= 2) {
+        TaskScheduler sched(w);
+        std::atomic<long> sink{0};
+        auto t0 = Clock::now();
+        sched.Submit([&] {
+            TaskGroup g(sched);
+            for (std::size_t i = 0; i < tasks; ++i)
+                g.Run([&sink, i] { sink.fetch_add((long)(i & 7), std::memory_order_relaxed); });
+            g.Wait();
+        });
+        sched.Wait();
+        auto t = us(Clock::now() - t0);
+        std::cout << "  потоков " << w << ": " << (t ? tasks * 1000000.0 / t / 1e6 : 0.0)
+                  << " млн задач/с\n";
+    }
+}
+
+void runAggregateTests() {
+    {
+        int a[] = {5, 3, 8, 1, 9, 2, 7};
+        AggregateSequence<int> sum(a, 7);
+        AggregateSequence<int, MinMonoid<int>> mn(a, 7);
+        AggregateSequence<int, MaxMonoid<int>> mx(a, 7);
+        for (std::size_t l = 0; l < 7; ++l) {
+            int s = 0, lo = a[l], hi = a[l];
+            for (std::size_t r = l; r < 7; ++r) {
+                s += a[r];
+                if (a[r] < lo) lo = a[r];
+                if (a[r] > hi) hi = a[r];
+                assert(sum.Query(l, r) == s);
+                assert(mn.Query(l, r) == lo);
+                assert(mx.Query(l, r) == hi);
+            }
+        }
+        assert(sum.Aggregate() == 35);
+
+        sum.Set(3, 10);
+        mn.Set(0, -4);
+        assert(sum.Query(2, 4) == 27 && sum.Get(3) == 10);
+        assert(mn.Aggregate() == -4);
+
+        bool threw = false;
+        try { sum.Query(3, 7); } catch (const std::out_of_range&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { sum[0] = 1; } catch (const std::logic_error&) { threw = true; }
+        assert(threw);
+    }
+    {
+        // Рост через Append/Prepend/InsertAt и доступ через Sequence<T>
+        AggregateSequence<long> seq;
+        assert(seq.Aggregate() == 0);
+        for (long i = 1; i <= 100; ++i) seq.Append(i);
+        assert(seq.Aggregate() == 5050 && seq.Query(9, 19) == 165);
+        seq.Prepend(1000);
+        seq.InsertAt(-1000, 50);
+        Sequence<long>& base = seq;
+        assert(base.GetLength() == 102 && base.GetFirst() == 1000 && base.Get(50) == -1000);
+        assert(seq.Aggregate() == 5050 && seq.Query(0, 0) == 1000);
+
+        const Sequence<long>& c = seq;
+        auto more = c.Append(7);
+        assert(static_cast<AggregateSequence<long>*>(more.get())->Aggregate() == 5057);
+        assert(seq.GetLength() == 102);
+
+        auto sub = seq.GetSubsequence(1, 10);
+        assert(static_cast<AggregateSequence<long>*>(sub.get())->Aggregate() == 55);
+    }
+    {
+        // Некоммутативный моноид: порядок сохраняется
+        struct Concat {
+            using Value = std::string;
+            static Value Identity() { return ""; }
+            static Value Lift(const std::string& v) { return v; }
+            static Value Combine(const Value& a, const Value& b) { return a + b; }
+        };
+        std::string w[] = {"a", "b", "c", "d", "e"};
+        AggregateSequence<std::string, Concat> s(w, 5);
+        assert(s.Query(1, 3) == "bcd" && s.Aggregate() == "abcde");
+        s.Set(2, "X");
+        assert(s.Query(0, 4) == "abXde");
+
+        AggregateSequence<double, StatsMonoid<double>> st;
+        double vals[] = {2.5, -1.0, 4.0};
+        st.AppendRange(vals, 3);
+        auto r = st.Query(0, 2);
+        assert(r.count == 3 && r.sum == 5.5 && r.min == -1.0 && r.max == 4.0);
+    }
+    {
+        // Аргумент из самой последовательности переживает Resize и сдвиг
+        int a[] = {100, 101, 102, 103, 104};
+        AggregateSequence<int> s(a, 5);
+        for (int i = 0; i < 20; ++i) s.Append(std::as_const(s)[0]);
+        assert(s.GetLength() == 25 && s.GetLast() == 100 && s.Aggregate() == 510 + 2000);
+        s.InsertAt(std::as_const(s)[4], 0);
+        assert(s.GetFirst() == 104 && s.Get(5) == 104);
+        s.AppendRange(&std::as_const(s)[0], 3);
+        assert(s.GetLength() == 29 && s.GetLast() == 101);
+        s.Concat(&s);
+        assert(s.GetLength() == 58 && s.Aggregate() == 2 * s.Query(0, 28));
+        // Из списка — одним проходом
+        MutableListSequence<int> l(a, 5);
+        AggregateSequence<int> fromList(l);
+        assert(fromList.Aggregate() == 510 && fromList.GetLast() == 104);
+    }
+    std::cout << "Тесты AggregateSequence пройдены!\n";
+}
+
+void benchAggregate() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    std::size_t n;
+    std::cout << "Размер последовательности> ";
+    if (!(std::cin >> n) || n == 0) return;
+    DynamicArray<int> raw(n);
+    for (std::size_t i = 0; i < n; ++i) raw[i] = (int)(i % 100);
+    MutableArraySequence<int> plain{raw};
+    AggregateSequence<int> agg(raw.Data(), n);
+    const std::size_t queries = 1000;
+    std::uint64_t rng = 12345;
+    auto next = [&] { rng = rng * 6364136223846793005ULL + 1442695040888963407ULL; return (std::size_t)(rng >> 33) % n; };
+
+    long s1 = 0;
+    auto t0 = Clock::now();
+    for (std::size_t q = 0; q < queries; ++q) {
+        std::size_t l = next(), r = next();
+        if (l > r) std::swap(l, r);
+        auto sub = plain.GetSubsequence(l, r);
+        s1 += Reduce<int, long>(*sub, 0L, [](const long& acc, const int& v) { return acc + v; });
+    }
+    auto tReduce = us(Clock::now() - t0);
+
+    rng = 12345;
+    long s2 = 0;
+    t0 = Clock::now();
+    for (std::size_t q = 0; q < queries; ++q) {
+        std::size_t l = next(), r = next();
+        if (l > r) std::swap(l, r);
+        s2 += agg.Query(l, r);
+    }
+    auto tQuery = us(Clock::now() - t0);
+
+    t0 = Clock::now();
+    for (std::size_t q = 0; q < queries; ++q) agg.Set(next(), (int)q);
+    auto tSet = us(Clock::now() - t0);
+
+    std::cout << queries << " запросов суммы на случайных отрезках:\n"
+              << "  GetSubsequence + Reduce: " << tReduce << " us (" << s1 << ")\n"
+              << "  AggregateSequence::Query: " << tQuery << " us (" << s2 << ")\n"
+              << "  " << queries << " точечных Set: " << tSet << " us\n";
+}
+
+void runWindowedQueueTests() {
+    {
+        // Сверка с прямым пересчётом на псевдослучайном потоке
+        WindowedQueue<int> w(5);
+        QueueSequence<int> ref;
+        std::uint64_t rng = 7;
+        for (int step = 0; step < 2000; ++step) {
+            rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+            int v = (int)(rng >> 40) % 50 - 25;
+            w.Enqueue(v);
+            ref.Enqueue(v);
+            if (ref.GetLength() > 5) ref.Dequeue();
+            if (step % 7 == 3) {
+                assert(w.Dequeue() == ref.Dequeue());
+                if (ref.GetLength() == 0) continue;
+            }
+            int lo = ref.Get(0), hi = lo, s = 0;
+            for (std::size_t i = 0; i < ref.GetLength(); ++i) {
+                int x = ref.Get(i);
+                if (x < lo) lo = x;
+                if (x > hi) hi = x;
+                s += x;
+            }
+            assert(w.GetLength() == ref.GetLength());
+            assert(w.GetMin() == lo && w.GetMax() == hi);
+            assert(w.GetSum() == s && w.Aggregate() == s);
+        }
+    }
+    {
+        // Произвольный моноид и некоммутативная операция
+        struct Concat {
+            using Value = std::string;
+            static Value Identity() { return ""; }
+            static Value Lift(const std::string& v) { return v; }
+            static Value Combine(const Value& a, const Value& b) { return a + b; }
+        };
+        WindowedQueue<std::string, Concat> q(3);
+        assert(q.Aggregate() == "");
+        q.Enqueue("a"); q.Enqueue("b");
+        assert(q.Aggregate() == "ab");
+        q.Enqueue("c"); q.Enqueue("d");
+        assert(q.Aggregate() == "bcd" && q.Peek() == "b");
+        q.Enqueue("e");
+        assert(q.Aggregate() == "cde" && q.GetMin() == "c" && q.GetMax() == "e");
+        assert(q.Dequeue() == "c" && q.Aggregate() == "de");
+
+        WindowedQueue<int, StatsMonoid<int>> st;
+        int xs[] = {4, -2, 9};
+        st.EnqueueRange(xs, 3);
+        auto r = st.Aggregate();
+        assert(r.count == 3 && r.sum == 11 && r.min == -2 && r.max == 9);
+    }
+    {
+        // Sequence API: InsertAt пересчитывает агрегаты, immutable-версии не трогают оригинал
+        WindowedQueue<int> w;
+        for (int i = 1; i <= 4; ++i) w.Append(i);
+        w.InsertAt(-10, 2);
+        assert(w.GetLength() == 5 && w.Get(2) == -10 && w.GetMin() == -10 && w.GetSum() == 0);
+        w.Prepend(100);
+        assert(w.GetMax() == 100 && w.GetFirst() == 100);
+        const Sequence<int>& c = w;
+        auto more = c.Append(5);
+        assert(more->GetLength() == 7 && w.GetLength() == 6);
+        assert(static_cast<WindowedQueue<int>*>(more.get())->GetSum() == 105);
+
+        bool threw = false;
+        WindowedQueue<int> empty;
+        try { empty.GetMin(); } catch (const std::out_of_range&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { empty.Dequeue(); } catch (const std::out_of_range&) { threw = true; }
+        assert(threw);
+    }
+    {
+        // Элемент окна как аргумент: вытеснение не портит значение
+        std::string a(40, 'a'), b(40, 'b');
+        WindowedQueue<std::string> w(2);
+        w.Enqueue(a); w.Enqueue(b);
+        w.Enqueue(std::as_const(w)[0]);
+        assert(w.GetFirst() == b && w.GetLast() == a && w.GetMin() == a);
+        w.InsertAt(std::as_const(w)[0], 1);
+        assert(w.GetFirst() == b && w.GetLast() == a);
+        w.InsertAt(std::as_const(w)[0], 2);
+        assert(w.GetFirst() == a && w.GetLast() == b);
+        w.EnqueueRange(&std::as_const(w)[0], 2);
+        assert(w.GetFirst() == a && w.GetLast() == b && w.Aggregate() == a + b);
+    }
+    std::cout << "Тесты WindowedQueue пройдены!\n";
+}
+
+void benchWindowedQueue() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    std::size_t window;
+    std::cout << "Размер окна> ";
+    if (!(std::cin >> window) || window == 0) return;
+    const std::size_t steps = 20000;
+    auto value = [](std::size_t i) { return (int)((i * 2654435761u) % 1000); };
+
+    long check1 = 0;
+    auto t0 = Clock::now();
+    {
+        QueueSequence<int> q;
+        for (std::size_t i = 0; i < steps; ++i) {
+            q.Enqueue(value(i));
+            if (q.GetLength() > window) q.Dequeue();
+            int lo = q.Get(0), hi = lo;
+            long s = 0;
+            for (std::size_t k = 0; k < q.GetLength(); ++k) {
+                int x = q.Get(k);
+                if (x < lo) lo = x;
+                if (x > hi) hi = x;
+                s += x;
+            }
+            check1 += lo + hi + s;
+        }
+    }
+    auto tRecompute = us(Clock::now() - t0);
+
+    long check2 = 0;
+    t0 = Clock::now();
+    {
+        WindowedQueue<int> q(window);
+        for (std::size_t i = 0; i < steps; ++i) {
+            q.Enqueue(value(i));
+            check2 += q.GetMin() + q.GetMax() + (long)q.GetSum();
+        }
+    }
+    auto tWindowed = us(Clock::now() - t0);
+
+    std::cout << steps << " шагов окна " << window << " (min, max, sum после каждого):\n"
+              << "  QueueSequence + пересчёт: " << tRecompute << " us (" << check1 << ")\n"
+              << "  WindowedQueue:            " << tWindowed << " us (" << check2 << ")\n";
+}
+
+void runGroupingTests() {
+    int a[] = {3, 1, 3, 2, 1, 5, 3};
+    int b[] = {5, 3, 9, 3};
+    MutableArraySequence<int> sa(a, 7);
+    MutableListSequence<int> sb(b, 4);
+    {
+        // Sequence::ForEach: порядок элементов у всех видов контейнеров
+        CompressedIntSequence<int> ca(a, 7);
+        BTreeSortedSequence<int> ss;
+        for (int v : b) ss.Add(v);
+        const Sequence<int>* srcs[] = {&sa, &ca};
+        for (const Sequence<int>* src : srcs) {
+            std::size_t pos = 0;
+            src->ForEach([&](const int& v) { assert(v == a[pos++]); });
+            assert(pos == 7);
+        }
+        std::size_t pos = 0;
+        sb.ForEach([&](const int& v) { assert(v == b[pos++]); });
+        assert(pos == 4);
+        int prev = 0;
+        pos = 0;
+        ss.ForEach([&](const int& v) { assert(v >= prev); prev = v; ++pos; });
+        assert(pos == 4 && prev == 9);
+    }
+    {
+        auto d = Distinct<int>(sa);
+        assert(d->GetLength() == 4 && d->Get(0) == 3 && d->Get(1) == 1 && d->Get(2) == 2 && d->Get(3) == 5);
+
+        auto in = Intersect<int>(sa, sb);
+        assert(in->GetLength() == 2 && in->Get(0) == 3 && in->Get(1) == 5);
+        auto ex = Except<int>(sa, sb);
+        assert(ex->GetLength() == 2 && ex->Get(0) == 1 && ex->Get(1) == 2);
+        MutableArraySequence<int> none;
+        assert(Intersect<int>(none, sb)->GetLength() == 0);
+        assert(Except<int>(sa, none)->GetLength() == 4);
+    }
+    {
+        auto parity = std::function<int(const int&)>([](const int& v) { return v % 2; });
+        auto g = GroupBy<int, int>(sa, parity);
+        assert(g.GetLength() == 2);
+        const MutableArraySequence<int>* odd = g.Find(1);
+        assert(odd && odd->GetLength() == 6 && odd->Get(0) == 3 && odd->Get(5) == 3);
+        assert(g.Find(0)->GetLength() == 1 && g.Find(0)->Get(0) == 2);
+
+        auto c = CountBy<int, int>(sa, std::function<int(const int&)>([](const int& v) { return v; }));
+        assert(*c.Find(3) == 3 && *c.Find(1) == 2 && *c.Find(5) == 1 && c.Find(4) == nullptr);
+    }
+    {
+        // Соединение: id -> имя, (id, сумма) -> строки «имя:сумма»
+        std::pair<int, std::string> users[] = {{1, "ann"}, {2, "bob"}, {3, "eve"}};
+        std::pair<int, int> orders[] = {{2, 10}, {1, 5}, {2, 7}, {4, 1}};
+        MutableArraySequence<std::pair<int, std::string>> su(users, 3);
+        MutableArraySequence<std::pair<int, int>> so(orders, 4);
+        auto j = Join<std::pair<int, int>, std::pair<int, std::string>, int, std::string>(
+            so, su,
+            [](const std::pair<int, int>& o) { return o.first; },
+            [](const std::pair<int, std::string>& u) { return u.first; },
+            [](const std::pair<int, int>& o, const std::pair<int, std::string>& u) {
+                return u.second + ":" + std::to_string(o.second);
+            });
+        assert(j->GetLength() == 3);
+        assert(j->Get(0) == "bob:10" && j->Get(1) == "ann:5" && j->Get(2) == "bob:7");
+
+        int dup[] = {1, 1};
+        MutableArraySequence<int> sd(dup, 2);
+        auto id = std::function<int(const int&)>([](const int& v) { return v; });
+        auto pairs = Join<int, int, int>(sd, sd, id, id);
+        assert(pairs->GetLength() == 4);
+    }
+    {
+        // Параллельная группировка совпадает с последовательной
+        const std::size_t n = 50000;
+        MutableArraySequence<int> big{DynamicArray<int>(n)};
+        for (std::size_t i = 0; i < n; ++i) big[i] = (int)((i * 7919) % 1000);
+        auto mod = std::function<int(const int&)>([](const int& v) { return v % 97; });
+        TaskScheduler sched(4);
+        auto pg = ParallelGroupBy<int, int>(big, mod, sched);
+        auto sg = GroupBy<int, int>(big, mod);
+        assert(pg.GetLength() == sg.GetLength() && pg.GetLength() == 97);
+        sg.ForEach([&](const int& k, const MutableArraySequence<int>& items) {
+            const MutableArraySequence<int>* other = pg.Find(k);
+            assert(other && other->GetLength() == items.GetLength());
+            for (std::size_t i = 0; i < items.GetLength(); ++i)
+                assert(other->Get(i) == items.Get(i));
+        });
+    }
+    std::cout << "Тесты Distinct/GroupBy/Join пройдены!\n";
+}
+
+void benchGrouping() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    std::size_t n;
+    std::cout << "Размер последовательности> ";
+    if (!(std::cin >> n) || n == 0) return;
+    MutableArraySequence<int> data{DynamicArray<int>(n)};
+    for (std::size_t i = 0; i < n; ++i) data[i] = (int)((i * 2654435761u) % (n / 4 + 1));
+
+    // Прежний способ: Distinct через TryFind по уже собранному результату
+    auto t0 = Clock::now();
+    MutableArraySequence<int> naive;
+    for (std::size_t i = 0; i < n; ++i) {
+        int v = data.Get(i), found;
+        if (!naive.TryFind([v](const int& x) { return x == v; }, found)) naive.Append(v);
+    }
+    auto tNaive = us(Clock::now() - t0);
+
+    t0 = Clock::now();
+    auto d = Distinct<int>(data);
+    auto tHash = us(Clock::now() - t0);
+
+    auto key = std::function<int(const int&)>([](const int& v) { return v % 1024; });
+    t0 = Clock::now();
+    auto g = GroupBy<int, int>(data, key);
+    auto tGroup = us(Clock::now() - t0);
+
+    unsigned hw = std::thread::hardware_concurrency();
+    TaskScheduler sched(hw ? hw : 1);
+    t0 = Clock::now();
+    auto pg = ParallelGroupBy<int, int>(data, key, sched);
+    auto tParallel = us(Clock::now() - t0);
+
+    std::cout << "Distinct по " << n << " элементам:\n"
+              << "  вложенный TryFind: " << tNaive << " us (" << naive.GetLength() << ")\n"
+              << "  хеш-таблица:       " << tHash << " us (" << d->GetLength() << ")\n"
+              << "GroupBy на 1024 ключа:\n"
+              << "  последовательно:   " << tGroup << " us (" << g.GetLength() << ")\n"
+              << "  параллельно (" << sched.GetWorkerCount() << " потоков): " << tParallel
+              << " us (" << pg.GetLength() << ")\n";
+}
+
+void runMergeTests() {
+    {
+        // Очередь: Dequeue снимает голову, копия не задета
+        QueueSequence<int> q;
+        for (int i = 0; i < 5; ++i) q.Enqueue(i);
+        auto cp = q.Clone();
+        assert(q.Dequeue() == 0 && q.Dequeue() == 1 && q.GetLength() == 3 && q.Peek() == 2);
+        assert(cp->GetLength() == 5 && cp->GetFirst() == 0);
+        q.Dequeue(); q.Dequeue(); q.Dequeue();
+        assert(q.GetLength() == 0);
+        q.Enqueue(9);
+        assert(q.Peek() == 9 && q.GetLast() == 9);
+    }
+    {
+        // Массивы, список и очереди вперемешку, включая пустые источники
+        int a[] = {1, 4, 9, 12};
+        int b[] = {2, 3, 10};
+        int c[] = {0, 4, 4, 20};
+        MutableArraySequence<int> sa(a, 4);
+        MutableListSequence<int> sb(b, 3);
+        MutableArraySequence<int> empty;
+        QueueSequence<int> q1, q2;
+        q1.EnqueueRange(c, 4);
+        q2.Enqueue(5);
+
+        KWayMerge<int> m;
+        m.AddSource(sa);
+        m.AddSource(empty);
+        m.AddSource(q1);
+        m.AddSource(sb);
+        m.AddSource(q2);
+        assert(m.GetSourceCount() == 5);
+        MutableArraySequence<int> out;
+        assert(ReadInto(m, out) == 12);
+        int expect[] = {0, 1, 2, 3, 4, 4, 4, 5, 9, 10, 12, 20};
+        for (std::size_t i = 0; i < 12; ++i) assert(out.Get(i) == expect[i]);
+        assert(q1.GetLength() == 0 && q2.GetLength() == 0 && sa.GetLength() == 4);
+        int v;
+        assert(!m.Next(v));
+
+        KWayMerge<int> none;
+        assert(!none.Next(v));
+    }
+    {
+        // Устойчивость: при равных ключах — порядок источников, убывание через Compare
+        using P = std::pair<int, char>;
+        auto byKeyDesc = [](const P& x, const P& y) { return x.first > y.first; };
+        P a[] = {{5, 'a'}, {3, 'a'}};
+        P b[] = {{5, 'b'}, {3, 'b'}, {1, 'b'}};
+        MutableArraySequence<P> sa(a, 2), sb(b, 3);
+        KWayMerge<P, decltype(byKeyDesc)> m(byKeyDesc);
+        m.AddSource(sa);
+        m.AddSource(sb);
+        P r[5];
+        assert(m.ReadChunk(r, 5) == 5);
+        assert(r[0] == P(5, 'a') && r[1] == P(5, 'b') && r[2] == P(3, 'a') && r[3] == P(3, 'b') && r[4] == P(1, 'b'));
+
+        MutableArraySequence<Sequence<int>*> parts;
+        int x[] = {1, 5}, y[] = {2, 3, 7};
+        MutableArraySequence<int> sx(x, 2), sy(y, 3);
+        parts.Append(&sx);
+        parts.Append(&sy);
+        auto all = MergeSorted<int>(parts);
+        assert(all->GetLength() == 5 && all->Get(0) == 1 && all->Get(2) == 3 && all->Get(4) == 7);
+
+        // Ленивое чтение через генератор
+        KWayMerge<int> lazy;
+        lazy.AddSource(sx);
+        lazy.AddSource(sy);
+        auto firstThree = Take(FromReader(lazy), 3);
+        int sum = 0;
+        for (int e : firstThree) sum += e;
+        assert(sum == 6);
+    }
+    {
+        // Соединение слиянием с сериями равных ключей
+        int a[] = {1, 2, 2, 4, 6};
+        int b[] = {2, 2, 3, 4, 4, 7};
+        MutableArraySequence<int> sa(a, 5), sb(b, 6);
+        auto id = std::function<int(const int&)>([](const int& v) { return v; });
+        auto j = MergeJoin<int, int, int>(sa, sb, id, id);
+        assert(j->GetLength() == 6);
+        for (std::size_t i = 0; i < j->GetLength(); ++i)
+            assert(j->Get(i).first == j->Get(i).second);
+        assert(j->Get(0).first == 2 && j->Get(3).first == 2 && j->Get(4).first == 4 && j->Get(5).first == 4);
+        MutableArraySequence<int> none;
+        auto noneJoin = MergeJoin<int, int, int>(none, sb, id, id);
+        assert(noneJoin->GetLength() == 0);
+
+        // Списки и сжатые источники читаются курсором Reader; ключ — раз на элемент
+        MutableListSequence<int> la(a, 5), lb(b, 6);
+        int keyCalls = 0;
+        auto counted = std::function<int(const int&)>([&](const int& v) { ++keyCalls; return v; });
+        auto lj = MergeJoin<int, int, int>(la, lb, counted, counted);
+        assert(lj->GetLength() == 6 && lj->Get(5).second == 4 && keyCalls <= 5 + 6);
+        CompressedIntSequence<int> ca(a, 5);
+        KWayMerge<int> m;
+        m.AddSource(ca);
+        m.AddSource(lb);
+        MutableArraySequence<int> merged;
+        assert(ReadInto(m, merged) == 11 && merged.Get(0) == 1 && merged.GetLast() == 7);
+        for (std::size_t i = 1; i < merged.GetLength(); ++i) assert(merged.Get(i - 1) <= merged.Get(i));
+    }
+    std::cout << "Тесты k-путевого слияния пройдены!\n";
+}
+
+void benchMerge() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    std::size_t k, len;
+    std::cout << "Число очередей и длина каждой> ";
+    if (!(std::cin >> k >> len) || k == 0) return;
+    auto fill = [&](DynamicArray<QueueSequence<int>>& qs) {
+        for (std::size_t i = 0; i < k; ++i) {
+            int v = (int)i;
+            for (std::size_t j = 0; j < len; ++j) {
+                v += (int)((i * 31 + j * 17) % 5);
+                qs[i].Enqueue(v);
+            }
+        }
+    };
+
+    DynamicArray<QueueSequence<int>> qs1(k);
+    fill(qs1);
+    auto t0 = Clock::now();
+    MutableArraySequence<int> concat;
+    for (std::size_t i = 0; i < k; ++i)
+        while (qs1[i].GetLength() > 0) concat.Append(qs1[i].Dequeue());
+    Sort(concat);
+    auto tSort = us(Clock::now() - t0);
+
+    DynamicArray<QueueSequence<int>> qs2(k);
+    fill(qs2);
+    t0 = Clock::now();
+    KWayMerge<int> m;
+    for (std::size_t i = 0; i < k; ++i) m.AddSource(qs2[i]);
+    MutableArraySequence<int> merged;
+    ReadInto(m, merged);
+    auto tMerge = us(Clock::now() - t0);
+
+    bool same = concat.GetLength() == merged.GetLength();
+    for (std::size_t i = 0; same && i < merged.GetLength(); ++i) same = concat.Get(i) == merged.Get(i);
+    std::cout << k << " очередей по " << len << " элементов:\n"
+              << "  конкатенация + Sort: " << tSort << " us\n"
+              << "  KWayMerge:           " << tMerge << " us (" << (same ? "совпадает" : "РАСХОЖДЕНИЕ") << ")\n";
+}
+
+static_assert(StaticSequence<MutableArraySequence<int>>);
+static_assert(StaticSequence<ImmutableListSequence<int>>);
+static_assert(StaticSequence<DynamicArray<int>>);
+static_assert(StaticSequence<int[4]>);
+static_assert(!StaticSequence<Sequence<int>>);
+static_assert(!StaticSequence<FixedArraySequence<int, 4>>);
+static_assert(!StaticSequence<QueueSequence<int>>);
+
+void runStaticAlgorithmTests() {
+    int raw[] = {5, -2, 7, 0, 3, 8};
+    MutableArraySequence<int> arr(raw, 6);
+    MutableListSequence<int> list(raw, 6);
+    DynamicArray<int> buf(raw, 6);
+    const Sequence<int>& base = arr;
+    auto twice = [](const int& v) { return v * 2; };
+    auto positive = [](const int& v) { return v > 0; };
+    {
+        // Результаты совпадают с виртуальными версиями для всех видов контейнеров
+        auto ref = Map<int, int>(base, twice);
+        auto m1 = Map(arr, twice);
+        auto m2 = Map(list, twice);
+        auto m3 = Map(buf, twice);
+        auto m4 = Map(raw, twice);
+        for (std::size_t i = 0; i < 6; ++i)
+            assert(m1.Get(i) == ref->Get(i) && m2.Get(i) == ref->Get(i) &&
+                   m3.Get(i) == ref->Get(i) && m4.Get(i) == ref->Get(i));
+
+        auto wref = Where<int>(base, positive);
+        auto w = Where(list, positive);
+        assert(w.GetLength() == wref->GetLength() && w.GetLength() == 4);
+        for (std::size_t i = 0; i < w.GetLength(); ++i) assert(w.Get(i) == wref->Get(i));
+
+        auto sum = [](long acc, const int& v) { return acc + v; };
+        assert(Reduce(arr, 0L, sum) == 21 && Reduce(list, 0L, sum) == 21 && Reduce(raw, 0L, sum) == 21);
+
+        assert(Find(list, [](const int& v) { return v > 6; }) == 7);
+        int out = 0;
+        assert(TryFind(arr, [](const int& v) { return v == 0; }, out) && out == 0);
+        assert(!TryFind(buf, [](const int& v) { return v > 100; }, out));
+        bool threw = false;
+        try { Find(raw, [](const int& v) { return v > 100; }); } catch (const std::runtime_error&) { threw = true; }
+        assert(threw);
+
+        // Тип результата выводится из f
+        auto strs = Map(arr, [](const int& v) { return std::to_string(v); });
+        assert(strs.Get(1) == "-2");
+    }
+    {
+        int pat[] = {7, 0, 3};
+        MutableListSequence<int> lpat(pat, 3);
+        assert(ContainsSubsequence(arr, lpat) && ContainsSubsequence(list, pat));
+        int bad[] = {7, 3};
+        assert(!ContainsSubsequence(list, bad) && ContainsSubsequence(arr, DynamicArray<int>()));
+
+        auto z = Zip(list, buf);
+        assert(z.GetLength() == 6 && z.Get(2).first == 7 && z.Get(2).second == 7);
+        auto [fs, ss] = Unzip(z);
+        assert(fs.GetLength() == 6 && ss.Get(5) == 8);
+
+        auto parts = Split(list, [](const int& v) { return v == 0; });
+        assert(parts.GetLength() == 2 && parts.Get(0).GetLength() == 3 && parts.Get(1).Get(1) == 8);
+
+        auto flat = FlatMap(arr, [](const int& v) { return DynamicArray<int>{v, v}; });
+        assert(flat.GetLength() == 12 && flat.Get(3) == -2);
+
+        int ins[] = {100, 200};
+        auto sl = Slice(list, -2, 1, ins);
+        auto slRef = Slice<int>(base, -2, 1, &arr);
+        assert(sl.GetLength() == 7 && sl.Get(4) == 100 && sl.Get(6) == 8);
+        assert(slRef->GetLength() == 11);
+        auto cut = Slice(arr, 1, 10);
+        assert(cut.GetLength() == 1 && cut.Get(0) == 5);
+    }
+    std::cout << "Тесты статических перегрузок алгоритмов пройдены!\n";
+}
+
+void benchStaticAlgorithms() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    std::size_t n;
+    std::cout << "Размер последовательности> ";
+    if (!(std::cin >> n) || n == 0) return;
+    MutableArraySequence<int> arr{DynamicArray<int>(n)};
+    for (std::size_t i = 0; i < n; ++i) arr[i] = (int)(i % 1000) - 500;
+    const Sequence<int>& base = arr;
+
+    auto run = [&](const char* name, auto dynamicFn, auto staticFn) {
+        auto t0 = Clock::now();
+        long a = dynamicFn();
+        auto td = us(Clock::now() - t0);
+        t0 = Clock::now();
+        long b = staticFn();
+        auto ts = us(Clock::now() - t0);
+        std::cout << "  " << name << ": Sequence + std::function " << td << " us, статически "
+                  << ts << " us, ускорение " << (ts ? (double)td / ts : 0.0)
+                  << (a == b ? "" : " (РАСХОЖДЕНИЕ)") << "\n";
+    };
+
+    std::cout << "Массив из " << n << " элементов:\n";
+    run("Map   ",
+        [&] { return (long)Map<int, int>(base, [](const int& v) { return v * 3 + 1; })->GetLast(); },
+        [&] { return (long)Map(arr, [](const int& v) { return v * 3 + 1; }).GetLast(); });
+    run("Where ",
+        [&] { return (long)Where<int>(base, [](const int& v) { return v > 0; })->GetLength(); },
+        [&] { return (long)Where(arr, [](const int& v) { return v > 0; }).GetLength(); });
+    run("Reduce",
+        [&] { return Reduce<int, long>(base, 0L, [](const long& acc, const int& v) { return acc + v; }); },
+        [&] { return Reduce(arr, 0L, [](long acc, const int& v) { return acc + v; }); });
+
+    std::size_t ln = n < 2000000 ? n : 2000000;
+    MutableListSequence<int> list;
+    for (std::size_t i = 0; i < ln; ++i) list.Append((int)(i % 1000) - 500);
+    std::cout << "Список из " << ln << " элементов (Reduce через ForEach vs обход узлов):\n";
+    const Sequence<int>& lbase = list;
+    run("Reduce",
+        [&] {
+            long acc = 0;
+            lbase.ForEach([&](const int& v) { acc += v; });
+            return acc;
+        },
+        [&] { return Reduce(list, 0L, [](long acc, const int& v) { return acc + v; }); });
+}
+
+void runPooledListTests() {
+    {
+        PooledLinkedList<int> l{3, 1, 2};
+        l.Prepend(0);
+        l.InsertAt(9, 2);
+        l.Append(7);
+        int expect[] = {0, 3, 9, 1, 2, 7};
+        assert(l.GetLength() == 6);
+        for (std::size_t i = 0; i < 6; ++i) assert(l.Get(i) == expect[i]);
+
+        // Снятые ячейки переиспользуются, пул не растёт
+        std::size_t pool = l.GetPoolSize();
+        assert(l.RemoveFirst() == 0 && l.RemoveFirst() == 3);
+        l.Append(5);
+        l.Append(6);
+        assert(l.GetPoolSize() == pool && l.GetLength() == 6 && l.GetLast() == 6);
+
+        l.MergeSort(std::less<int>());
+        int sorted[] = {1, 2, 5, 6, 7, 9};
+        std::size_t i = 0;
+        for (int v : l) assert(v == sorted[i++]);
+        assert(l.GetFirst() == 1 && l.GetLast() == 9);
+        l.Append(10);
+        assert(l.GetLast() == 10);
+
+        PooledLinkedList<int> cp(l);
+        cp[0] = 100;
+        assert(l.Get(0) == 1 && cp.Get(0) == 100 && cp.GetPoolSize() == cp.GetLength());
+        l.Compact();
+        assert(l.GetPoolSize() == l.GetLength() && l.Get(6) == 10);
+
+        while (l.GetLength() > 0) l.RemoveFirst();
+        bool threw = false;
+        try { l.RemoveFirst(); } catch (const std::out_of_range&) { threw = true; }
+        assert(threw);
+        l.Append(42);
+        assert(l.GetFirst() == 42 && l.GetLast() == 42);
+    }
+    {
+        // Бэкенд ListSequence: весь Sequence API, сортировка, статические алгоритмы
+        int raw[] = {4, -1, 8, 3};
+        PooledListSequence<int> seq(raw, 4);
+        seq.Append(0);
+        seq.InsertAt(5, 1);
+        assert(seq.GetLength() == 6 && seq.Get(1) == 5 && seq.GetLast() == 0);
+        auto sub = seq.GetSubsequence(1, 3);
+        assert(sub->GetLength() == 3 && sub->Get(1) == -1 && sub->Get(2) == 8);
+        const Sequence<int>& c = seq;
+        auto more = c.Prepend(9);
+        assert(more->GetFirst() == 9 && seq.GetFirst() == 4);
+        int found;
+        assert(seq.TryFind([](const int& v) { return v > 6; }, found) && found == 8);
+
+        Sort(seq);
+        assert(seq.Get(0) == -1 && seq.Get(5) == 8);
+        assert(Reduce(seq, 0, [](int a, const int& v) { return a + v; }) == 19);
+        static_assert(sizeof(PooledLinkedList<int>::Index) == 4);
+
+        ImmutableListSequence<int, PooledLinkedList<int>> frozen(raw, 4);
+        auto grown = static_cast<const Sequence<int>&>(frozen).Append(1);
+        assert(grown->GetLength() == 5 && frozen.GetLength() == 4);
+        bool threw = false;
+        try { frozen.Append(1); } catch (const std::logic_error&) { threw = true; }
+        assert(threw);
+    }
+    {
+        // Элемент списка как аргумент вставки: пул растёт и переносит vals_
+        PooledListSequence<std::string> self;
+        self.Append("first-element-long-enough-for-heap");
+        for (int i = 0; i < 100; ++i) {
+            self.Append(std::as_const(self)[0]);
+            self.Prepend(std::as_const(self)[self.GetLength() - 1]);
+        }
+        assert(self.GetLength() == 201 && self.GetLast() == self.GetFirst());
+    }
+    std::cout << "Тесты PooledLinkedList пройдены!\n";
+}
+
+void benchPooledList() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    std::size_t n;
+    std::cout << "Число элементов> ";
+    if (!(std::cin >> n) || n == 0) return;
+    auto sum = [](long acc, const int& v) { return acc + v; };
+
+    auto t0 = Clock::now();
+    MutableListSequence<int> heap;
+    for (std::size_t i = 0; i < n; ++i) heap.Append((int)(i * 7 % 1000));
+    auto tBuildHeap = us(Clock::now() - t0);
+    t0 = Clock::now();
+    long s1 = Reduce(heap, 0L, sum);
+    auto tScanHeap = us(Clock::now() - t0);
+
+    t0 = Clock::now();
+    PooledListSequence<int> pooled;
+    for (std::size_t i = 0; i < n; ++i) pooled.Append((int)(i * 7 % 1000));
+    auto tBuildPool = us(Clock::now() - t0);
+    t0 = Clock::now();
+    long s2 = Reduce(pooled, 0L, sum);
+    auto tScanPool = us(Clock::now() - t0);
+
+    double grown = (double)pooled.GetList().MemoryUsage() / n;
+
+    t0 = Clock::now();
+    Sort(heap);
+    auto tSortHeap = us(Clock::now() - t0);
+    t0 = Clock::now();
+    Sort(pooled);
+    auto tSortPool = us(Clock::now() - t0);
+
+    std::cout << n << " элементов int:\n"
+              << "  узлы в куче: узел " << sizeof(LinkedList<int>::Node) << " байт + заголовок аллокатора;"
+              << " построение " << tBuildHeap << " us, обход " << tScanHeap << " us, сортировка "
+              << tSortHeap << " us (" << s1 << ")\n"
+              << "  пул:         " << grown << " байт на элемент с запасом ёмкости;"
+              << " построение " << tBuildPool << " us, обход " << tScanPool << " us, сортировка "
+              << tSortPool << " us (" << s2 << ")\n";
+}
+
+void runPackedSequenceTests() {
+    {
+        // Сверка BitSequence с массивом bool, в том числе на границах слов
+        BitSequence bits;
+        MutableArraySequence<bool> ref;
+        std::uint64_t rng = 3;
+        for (int i = 0; i < 300; ++i) {
+            rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+            bool v = (rng >> 40) & 1;
+            if (i % 17 == 5) {
+                std::size_t at = (rng >> 20) % (ref.GetLength() + 1);
+                bits.InsertAt(v, at);
+                ref.InsertAt(v, at);
+            } else {
+                bits.Append(v);
+                ref.Append(v);
+            }
+        }
+        bits.Prepend(true);
+        ref.Prepend(true);
+        bits.InsertAt(true, 63);
+        ref.InsertAt(true, 63);
+        std::size_t count = 0;
+        assert(bits.GetLength() == ref.GetLength());
+        for (std::size_t i = 0; i < ref.GetLength(); ++i) {
+            assert(bits.Get(i) == ref.Get(i));
+            if (ref.Get(i)) ++count;
+        }
+        assert(bits.Count() == count);
+        auto where = bits.Where();
+        assert(where.GetLength() == count);
+        for (std::size_t k = 0; k < where.GetLength(); ++k) assert(ref.Get(where.Get(k)));
+
+        bits.Set(1, !bits.Get(1));
+        assert(bits.Count() == count + (bits.Get(1) ? 1 : 0) - (bits.Get(1) ? 0 : 1));
+        BitSequence ones(130, true);
+        assert(ones.Count() == 130 && ones.GetLast());
+        ones.Append(false);
+        assert(ones.Count() == 130 && ones.Where().GetLast() == 129);
+        auto sub = ones.GetSubsequence(60, 70);
+        assert(sub->GetLength() == 11 && sub->Get(10));
+
+        bool threw = false;
+        try { bits[0] = true; } catch (const std::logic_error&) { threw = true; }
+        assert(threw);
+    }
+    {
+        // Отсортированные отметки времени: значения, блоки, индекс пропуска
+        const std::size_t n = 1000;
+        DynamicArray<std::int64_t> ts(n);
+        std::int64_t t = 1700000000000LL;
+        for (std::size_t i = 0; i < n; ++i) {
+            t += (std::int64_t)((i * 37) % 100);
+            ts[i] = t;
+        }
+        ts[500] = -5;  // выброс: отрицательная разность
+        CompressedIntSequence<std::int64_t> c(ts.Data(), n);
+        assert(c.GetLength() == n && c.GetFirst() == ts[0] && c.GetLast() == ts[n - 1]);
+        for (std::size_t i = 0; i < n; i += 7) assert(c.Get(i) == ts[i]);
+        assert(c.Get(127) == ts[127] && c.Get(128) == ts[128] && c.Get(500) == -5);
+        assert(c.MemoryUsage() < n * sizeof(std::int64_t) / 3);
+
+        long double total = 0;
+        for (std::size_t i = 0; i < n; ++i) total += ts[i];
+        assert(c.Reduce((long double)0, [](long double acc, std::int64_t v) { return acc + v; }) == total);
+        DynamicArray<std::int64_t> back(n);
+        c.DecodeInto(back.Data());
+        for (std::size_t i = 0; i < n; ++i) assert(back[i] == ts[i]);
+
+        auto sub = c.GetSubsequence(120, 260);
+        assert(sub->GetLength() == 141 && sub->Get(0) == ts[120] && sub->GetLast() == ts[260]);
+        const Sequence<std::int64_t>& base = c;
+        auto grown = base.Append(7);
+        auto ins = base.InsertAt(9, 128);
+        assert(grown->GetLength() == n + 1 && grown->GetLast() == 7 && c.GetLength() == n);
+        assert(ins->Get(128) == 9 && ins->Get(129) == ts[128] && ins->GetLast() == ts[n - 1]);
+        std::int64_t found;
+        assert(c.TryFind([](const std::int64_t& v) { return v < 0; }, found) && found == -5);
+
+        bool threw = false;
+        try { c.Append(1); } catch (const std::logic_error&) { threw = true; }
+        assert(threw);
+
+        // Крайние значения и беззнаковый тип
+        std::int32_t ext[] = {INT32_MAX, INT32_MIN, 0, INT32_MAX, -1};
+        CompressedIntSequence<std::int32_t> ce(ext, 5);
+        for (std::size_t i = 0; i < 5; ++i) assert(ce.Get(i) == ext[i]);
+        std::uint16_t us16[] = {65535, 0, 1, 65534};
+        CompressedIntSequence<std::uint16_t> cu(us16, 4);
+        for (std::size_t i = 0; i < 4; ++i) assert(cu.Get(i) == us16[i]);
+        threw = false;
+        try { (void)std::as_const(cu)[0]; } catch (const std::logic_error&) { threw = true; }
+        assert(threw);
+        // Обобщённые алгоритмы идут по блокам через ForEach
+        const Sequence<std::int32_t>& cext = ce;
+        assert((Reduce<std::int32_t, long>(cext, 0L, [](const long& acc, const std::int32_t& v) { return acc + v; })
+                == ext[0] + ext[1] + ext[2] + ext[3] + ext[4]));
+        auto pos = Where<std::int32_t>(cext, [](const std::int32_t& v) { return v > 0; });
+        for (std::size_t i = 0, j = 0; i < 5; ++i)
+            if (ext[i] > 0) assert(pos->Get(j++) == ext[i]);
+    }
+    std::cout << "Тесты BitSequence и CompressedIntSequence пройдены!\n";
+}
+
+void benchPackedSequences() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    std::size_t n;
+    std::cout << "Число элементов> ";
+    if (!(std::cin >> n) || n == 0) return;
+
+    MutableArraySequence<bool> flags{DynamicArray<bool>(n)};
+    BitSequence bits(n, false);
+    for (std::size_t i = 0; i < n; ++i) {
+        bool v = (i * 2654435761u) % 7 == 0;
+        flags[i] = v;
+        if (v) bits.Set(i, true);
+    }
+    auto t0 = Clock::now();
+    long c1 = Reduce(flags, 0L, [](long acc, const bool& v) { return acc + v; });
+    auto tArr = us(Clock::now() - t0);
+    t0 = Clock::now();
+    long c2 = (long)bits.Count();
+    auto tBits = us(Clock::now() - t0);
+    std::cout << "Флаги: " << n << " байт vs " << bits.MemoryUsage() << " байт; подсчёт "
+              << tArr << " us vs " << tBits << " us (" << c1 << "/" << c2 << ")\n";
+
+    DynamicArray<std::int64_t> raw(n);
+    std::int64_t t = 1700000000000LL;
+    for (std::size_t i = 0; i < n; ++i) raw[i] = (t += (std::int64_t)((i * 37) % 100));
+    MutableArraySequence<std::int64_t> plain{raw};
+    CompressedIntSequence<std::int64_t> packed(raw.Data(), n);
+    auto sum = [](std::int64_t acc, std::int64_t v) { return acc + (v & 1023); };
+    t0 = Clock::now();
+    std::int64_t s1 = Reduce(plain, (std::int64_t)0, sum);
+    auto tPlain = us(Clock::now() - t0);
+    t0 = Clock::now();
+    std::int64_t s2 = packed.Reduce((std::int64_t)0, sum);
+    auto tPacked = us(Clock::now() - t0);
+    // Через Sequence&: обобщённый Reduce (ForEach по блокам) и цикл по индексам с Get,
+    // который на каждом шаге заново декодирует начало блока
+    const Sequence<std::int64_t>& pbase = packed;
+    t0 = Clock::now();
+    std::int64_t s4 = Reduce<std::int64_t, std::int64_t>(pbase, 0, sum);
+    auto tGeneric = us(Clock::now() - t0);
+    t0 = Clock::now();
+    std::int64_t s5 = 0;
+    for (std::size_t i = 0; i < n; ++i) s5 = sum(s5, pbase.Get(i));
+    auto tIndexed = us(Clock::now() - t0);
+    const std::size_t probes = 100000;
+    std::int64_t s3 = 0;
+    t0 = Clock::now();
+    for (std::size_t k = 0; k < probes; ++k) s3 += packed.Get((k * 2654435761u) % n) & 1;
+    auto tGet = us(Clock::now() - t0);
+    std::cout << "Отметки времени: " << n * sizeof(std::int64_t) << " байт vs " << packed.MemoryUsage()
+              << " байт; Reduce " << tPlain << " us vs " << tPacked << " us (" << (s1 == s2 ? "совпадает" : "РАСХОЖДЕНИЕ")
+              << "); " << probes << " случайных Get: " << tGet << " us (" << s3 << ")\n"
+              << "Через Sequence&: Reduce " << tGeneric << " us, цикл с Get " << tIndexed << " us ("
+              << (s4 == s2 && s5 == s2 ? "совпадает" : "РАСХОЖДЕНИЕ") << ")\n";
+}
+
+void runStringSequenceTests() {
+    {
+        // Арена: строки не переезжают при росте, интернирование находит равные
+        StringArena arena;
+        std::string big(StringArena::kChunk + 10, 'x');
+        std::string_view a = arena.Add("alpha");
+        std::string_view b = arena.Add(big);
+        for (int i = 0; i < 20000; ++i) arena.Add("filler-string");
+        assert(a == "alpha" && b == big && arena.GetChunkCount() >= 3);
+        std::string_view i1 = arena.Intern("beta");
+        std::string_view i2 = arena.Intern(std::string("be") + "ta");
+        assert(i1 == "beta" && i1.data() == i2.data());
+        assert(arena.Add("").empty());
+        arena.Clear();
+        assert(arena.GetBytes() == 0 && arena.GetChunkCount() == 0);
+    }
+    {
+        StringSequence seq;
+        {
+            std::string tmp = "temporary string longer than SSO";
+            seq.Append(tmp);
+        }  // источник умер — копия в арене
+        seq.Append("b");
+        seq.Prepend("a");
+        seq.InsertAt("mid", 2);
+        assert(seq.GetLength() == 4 && seq.Get(0) == "a" && seq.Get(1) == "temporary string longer than SSO");
+        assert(seq.Get(2) == "mid" && seq.GetLast() == "b");
+        seq.Set(3, "c");
+        assert(std::as_const(seq)[3] == "c");
+
+        const Sequence<std::string_view>& c = seq;
+        auto grown = c.Append("d");
+        assert(grown->GetLength() == 5 && grown->GetLast() == "d" && seq.GetLength() == 4);
+        auto sub = c.GetSubsequence(1, 2);
+        assert(sub->GetLength() == 2 && sub->Get(1) == "mid");
+        StringSequence copy(seq);
+        seq.Set(0, "z");
+        assert(copy.Get(0) == "a" && copy.Get(0).data() != seq.Get(1).data());
+        std::string_view found;
+        assert(c.TryFind([](const std::string_view& v) { return v.size() > 10; }, found) && found.size() > 10);
+
+        bool threw = false;
+        try { seq[0] = "x"; } catch (const std::logic_error&) { threw = true; }
+        assert(threw);
+    }
+    {
+        // Интернирование: повторы не занимают арену
+        StringSequence interned(true);
+        for (int i = 0; i < 1000; ++i) interned.Append("repeated-value-" + std::to_string(i % 10));
+        assert(interned.GetLength() == 1000 && interned.Get(13) == "repeated-value-3");
+        assert(interned.Get(3).data() == interned.Get(13).data());
+        assert(interned.GetArena().GetBytes() == 10 * 16);
+    }
+    {
+        // Очередь: порядок FIFO, пересборка арены при долгой работе
+        StringQueue q;
+        for (int i = 0; i < 100; ++i) q.Enqueue("item-" + std::to_string(i));
+        std::size_t next = 0;
+        for (int round = 0; round < 50000; ++round) {
+            assert(q.Dequeue() == "item-" + std::to_string(next++));
+            q.Enqueue("item-" + std::to_string(next + 99));
+        }
+        assert(q.GetLength() == 100 && q.Peek() == "item-" + std::to_string(next));
+        assert(q.MemoryUsage() < 8 * StringArena::kChunk);
+        while (q.GetLength()) q.Dequeue();
+        bool threw = false;
+        try { q.Dequeue(); } catch (const std::out_of_range&) { threw = true; }
+        assert(threw);
+
+        StringQueue iq(true);
+        for (int i = 0; i < 200000; ++i) {
+            iq.Enqueue(i % 2 ? "odd" : "even");
+            if (i >= 10) iq.Dequeue();
+        }
+        assert(iq.GetLength() == 10 && iq.Peek() == "even");
+        const Sequence<std::string_view>& cq = iq;
+        // Повторная постановка снятой строки: пересборка арены не должна её потерять
+        StringQueue rq;
+        for (int i = 0; i < 10000; ++i) rq.Enqueue("requeue-payload-" + std::to_string(i));
+        for (int i = 0; i < 9000; ++i) rq.Dequeue();
+        for (int i = 0; i < 3000; ++i) {
+            std::string expect(rq.Peek());
+            rq.Enqueue(rq.Dequeue());
+            assert(rq.GetLast() == expect);
+        }
+        rq.Prepend(rq.Peek());
+        rq.InsertAt(rq.Get(5), 3);
+        assert(rq.GetLength() == 1002 && rq.Get(0) == rq.Get(1) && rq.Get(3) == rq.Get(6));
+        auto cp = cq.Prepend("first");
+        assert(cp->GetFirst() == "first" && cp->GetLength() == 11 && iq.GetLength() == 10);
+    }
+    std::cout << "Тесты StringArena, StringSequence и StringQueue пройдены!\n";
+}
+
+void benchStringQueue() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    std::size_t n, distinct;
+    std::cout << "Число строк> ";
+    if (!(std::cin >> n) || n == 0) return;
+    std::cout << "Различных значений> ";
+    if (!(std::cin >> distinct) || distinct == 0) return;
+
+    DynamicArray<std::string> src(n);
+    std::size_t chars = 0, heapStrings = 0, heapChars = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        src[i] = "customer:" + std::to_string((i * 2654435761u) % distinct) + "/order";
+        chars += src[i].size();
+        if (src[i].size() > std::string().capacity()) {
+            ++heapStrings;
+            heapChars += src[i].size() + 1;
+        }
+    }
+
+    std::size_t len1 = 0, len2 = 0, len3 = 0;
+    auto t0 = Clock::now();
+    QueueSequence<std::string> plain;
+    for (std::size_t i = 0; i < n; ++i) plain.Enqueue(src[i]);
+    auto tEnq1 = us(Clock::now() - t0);
+    t0 = Clock::now();
+    while (plain.GetLength()) len1 += plain.Dequeue().size();
+    auto tDeq1 = us(Clock::now() - t0);
+
+    t0 = Clock::now();
+    StringQueue arena;
+    for (std::size_t i = 0; i < n; ++i) arena.Enqueue(src[i]);
+    auto tEnq2 = us(Clock::now() - t0);
+    std::size_t mem2 = arena.MemoryUsage();
+    t0 = Clock::now();
+    while (arena.GetLength()) len2 += arena.Dequeue().size();
+    auto tDeq2 = us(Clock::now() - t0);
+
+    t0 = Clock::now();
+    StringQueue interned(true);
+    for (std::size_t i = 0; i < n; ++i) interned.Enqueue(src[i]);
+    auto tEnq3 = us(Clock::now() - t0);
+    std::size_t mem3 = interned.MemoryUsage();
+    t0 = Clock::now();
+    while (interned.GetLength()) len3 += interned.Dequeue().size();
+    auto tDeq3 = us(Clock::now() - t0);
+
+    // Узел списка + заголовок аллокатора на узел и на каждую строку вне SSO
+    std::size_t mem1 = n * (sizeof(LinkedList<std::string>::Node) + 16)
+                     + heapStrings * 16 + heapChars;
+    std::cout << n << " строк (" << chars << " символов, " << distinct << " различных):\n"
+              << "  QueueSequence<std::string>: ~" << mem1 << " байт (оценка); Enqueue "
+              << tEnq1 << " us, Dequeue " << tDeq1 << " us\n"
+              << "  StringQueue:                " << mem2 << " байт; Enqueue "
+              << tEnq2 << " us, Dequeue " << tDeq2 << " us\n"
+              << "  StringQueue (интерн.):      " << mem3 << " байт; Enqueue "
+              << tEnq3 << " us, Dequeue " << tDeq3 << " us"
+              << (len1 == len2 && len2 == len3 ? "" : " РАСХОЖДЕНИЕ") << "\n";
+}
+
+void runSegmentedArrayTests() {
+    {
+        // Мелкие блоки по 16 элементов: много переходов через границы
+        SegmentedArraySequence<int, 4> seg;
+        for (int i = 0; i < 40; ++i) seg.Append(i);
+        const int* first = &std::as_const(seg)[0];
+        const int* mid = &std::as_const(seg)[17];
+        for (int i = 40; i < 5000; ++i) seg.Append(i);
+        assert(first == &std::as_const(seg)[0] && mid == &std::as_const(seg)[17]);
+        assert(seg.GetLength() == 5000 && seg.GetBlockCount() == (5000 + 15) / 16);
+        for (int i = 0; i < 5000; i += 37) assert(seg.Get(i) == i);
+
+        seg.InsertAt(-1, 16);
+        seg.Prepend(-2);
+        assert(seg.Get(0) == -2 && seg.Get(1) == 0 && seg.Get(17) == -1 && seg.Get(18) == 16);
+        assert(seg.GetLast() == 4999 && seg.GetLength() == 5002);
+        assert(first == &std::as_const(seg)[0]);  // значения сдвинулись, память — нет
+        seg[5] = 100;
+        assert(seg.Get(5) == 100);
+
+        std::size_t blocks = 0, total = 0;
+        seg.ForEachBlock([&](const int*, std::size_t n) { ++blocks; total += n; });
+        assert(blocks == seg.GetBlockCount() && total == seg.GetLength());
+        long sum = 0;
+        seg.ForEach([&](const int& v) { sum += v; });
+        assert(sum == Reduce(seg, 0L, [](long acc, const int& v) { return acc + v; }));
+        auto even = Where(seg, [](const int& v) { return v >= 0 && v % 2 == 0; });
+        assert(even.GetLength() == 2500 && even.Get(0) == 0 && even.GetLast() == 4998);
+
+        auto sub = seg.GetSubsequence(10, 40);
+        assert(sub->GetLength() == 31 && sub->Get(0) == seg.Get(10) && sub->GetLast() == seg.Get(40));
+        const Sequence<int>& c = seg;
+        auto grown = c.Append(7);
+        assert(grown->GetLength() == 5003 && grown->GetLast() == 7 && seg.GetLength() == 5002);
+        int found;
+        assert(c.TryFind([](const int& v) { return v == -1; }, found) && found == -1);
+
+        while (seg.GetLength() > 33) seg.PopBack();
+        assert(seg.GetBlockCount() == 3 && seg.GetLast() == 30);
+        while (seg.GetLength()) seg.PopBack();
+        assert(seg.GetBlockCount() == 0);
+        bool threw = false;
+        try { seg.PopBack(); } catch (const std::out_of_range&) { threw = true; }
+        assert(threw);
+    }
+    {
+        // Копия не делит блоки и тоже растёт без переезда
+        SegmentedArraySequence<std::string, 3> a;
+        for (int i = 0; i < 20; ++i) a.Append(std::to_string(i));
+        SegmentedArraySequence<std::string, 3> b(a);
+        const std::string* last = &std::as_const(b)[19];
+        b.Append("x");
+        b[0] = "changed";
+        assert(last == &std::as_const(b)[19] && a.Get(0) == "0" && b.GetLast() == "x");
+    }
+    std::cout << "Тесты SegmentedArraySequence пройдены!\n";
+}
+
+// Счётчик выделенной памяти для сравнения пиков (политика Alloc у DynamicArray)
+struct CountingAllocator {
+    static inline std::size_t current = 0;
+    static inline std::size_t peak = 0;
+
+    template<typename T>
+    static T* Allocate(std::size_t n) {
+        current += n * sizeof(T);
+        if (current > peak) peak = current;
+        return NewAllocator::Allocate<T>(n);
+    }
+    template<typename T>
+    static void Deallocate(T* p, std::size_t n) {
+        if (p) current -= n * sizeof(T);
+        NewAllocator::Deallocate<T>(p, n);
+    }
+};
+
+void benchSegmentedArray() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    std::size_t n;
+    std::cout << "Число элементов long long> ";
+    if (!(std::cin >> n) || n == 0) return;
+    const std::size_t probes = 1000000;
+
+    CountingAllocator::current = CountingAllocator::peak = 0;
+    auto t0 = Clock::now();
+    {
+        DynamicArray<long long, DoublingGrowth, CheckedBounds, CountingAllocator> arr;
+        for (std::size_t i = 0; i < n; ++i) {
+            arr.Resize(i + 1);
+            arr[i] = (long long)i;
+        }
+        auto tAppend = us(Clock::now() - t0);
+        std::size_t final = arr.GetCapacity() * sizeof(long long);
+        t0 = Clock::now();
+        long long s = 0;
+        for (std::size_t k = 0; k < probes; ++k) s += arr[(k * 2654435761u) % n];
+        auto tGet = us(Clock::now() - t0);
+        t0 = Clock::now();
+        for (std::size_t i = 0; i < n; ++i) s += arr[i];
+        auto tScan = us(Clock::now() - t0);
+        std::cout << "DynamicArray:          Append " << tAppend << " us, пик " << CountingAllocator::peak
+                  << " байт при " << final << " в конце; " << probes << " Get " << tGet
+                  << " us, обход " << tScan << " us (" << s << ")\n";
+    }
+
+    CountingAllocator::current = CountingAllocator::peak = 0;
+    t0 = Clock::now();
+    {
+        SegmentedArraySequence<long long, 12, CountingAllocator> seg;
+        for (std::size_t i = 0; i < n; ++i) seg.Append((long long)i);
+        auto tAppend = us(Clock::now() - t0);
+        t0 = Clock::now();
+        long long s = 0;
+        for (std::size_t k = 0; k < probes; ++k) s += std::as_const(seg)[(k * 2654435761u) % n];
+        auto tGet = us(Clock::now() - t0);
+        t0 = Clock::now();
+        seg.ForEach([&](const long long& v) { s += v; });
+        auto tScan = us(Clock::now() - t0);
+        std::cout << "SegmentedArraySequence: Append " << tAppend << " us, пик " << CountingAllocator::peak
+                  << " байт блоков (+ каталог " << seg.MemoryUsage() - CountingAllocator::peak << "); "
+                  << probes << " Get " << tGet << " us, обход " << tScan << " us (" << s << ")\n";
+    }
+}
+
+namespace {
+struct PodRecord {
+    int id;
+    double score;
+    char tag[4];
+};
+}
+
+// Одни и те же операции для тривиального (memcpy/memmove) и нетривиального T
+template<typename T, typename Make>
+static void checkBulkPaths(Make make) {
+    DynamicArray<T> a;
+    for (int i = 0; i < 100; ++i) {
+        a.Resize(i + 1);  // несколько переездов буфера
+        a[i] = make(i);
+    }
+    DynamicArray<T> b(a);
+    DynamicArray<T> c;
+    c = b;
+    DynamicArray<T> d(a.Data() + 10, 5);
+    for (int i = 0; i < 100; ++i) assert(b[i] == make(i) && c[i] == make(i));
+    assert(d.GetSize() == 5 && d[0] == make(10) && d[4] == make(14));
+
+    MutableArraySequence<T> seq(a.Data(), 50);
+    seq.InsertAt(make(-1), 10);
+    seq.Prepend(make(-2));
+    seq.InsertAt(make(-3), seq.GetLength());
+    assert(seq.GetLength() == 53 && seq.Get(0) == make(-2) && seq.Get(1) == make(0));
+    assert(seq.Get(11) == make(-1) && seq.Get(12) == make(10) && seq.GetLast() == make(-3));
+    seq.AppendRange(a.Data() + 50, 50);
+    assert(seq.GetLength() == 103 && seq.GetLast() == make(99));
+
+    // Клон разделяет буфер; первая запись копирует его целиком
+    auto clone = seq.Clone();
+    seq.InsertAt(make(-4), 0);
+    assert(clone->GetLength() == 103 && clone->Get(0) == make(-2) && seq.Get(1) == make(-2));
+    auto sub = seq.GetSubsequence(2, 12);
+    assert(sub->GetLength() == 11 && sub->Get(0) == make(0) && sub->Get(10) == make(-1));
+
+    // Аргумент — элемент этой же последовательности: рост буфера и сдвиг его не портят
+    MutableArraySequence<T> self;
+    self.Append(make(0));
+    for (int i = 1; i < 40; ++i) {
+        self.Append(std::as_const(self)[0]);
+        self.InsertAt(std::as_const(self)[self.GetLength() - 1], 0);
+        self.Prepend(std::as_const(self)[1]);
+    }
+    assert(self.GetLength() == 118 && self.Get(0) == make(0) && self.GetLast() == make(0));
+    self.AppendRange(&std::as_const(self)[0], self.GetLength());
+    assert(self.GetLength() == 236 && self.Get(235) == make(0));
+
+    ImmutableArraySequence<T> im(a.Data(), 20);
+    const Sequence<T>& ic = im;
+    auto ins = ic.InsertAt(make(-5), 5);
+    assert(ins->Get(5) == make(-5) && ins->Get(6) == make(5) && im.Get(5) == make(5));
+    auto isub = ic.GetSubsequence(3, 7);
+    assert(isub->GetLength() == 5 && isub->Get(0) == make(3));
+}
+
+void runBulkCopyTests() {
+    checkBulkPaths<int>([](int i) { return i; });
+    checkBulkPaths<std::string>([](int i) { return "value-" + std::to_string(i) + "-long-enough-for-heap"; });
+    static_assert(std::is_trivially_copyable_v<PodRecord>);
+    DynamicArray<PodRecord> pods;
+    for (int i = 0; i < 1000; ++i) {
+        pods.Resize(i + 1);
+        pods[i] = PodRecord{i, i * 0.5, {'a', 'b', 'c', 0}};
+    }
+    MutableArraySequence<PodRecord> ps(pods.Data(), pods.GetSize());
+    ps.InsertAt(PodRecord{-1, 0.0, {'x', 0, 0, 0}}, 500);
+    assert(ps.Get(500).id == -1 && ps.Get(501).id == 500 && ps.Get(501).score == 250.0);
+    assert(ps.GetLast().id == 999 && ps.Get(999).tag[2] == 'c');
+    std::cout << "Тесты быстрых путей копирования пройдены!\n";
+}
+
+void benchBulkCopy() {
+    using Clock = std::chrono::high_resolution_clock;
+    auto ns = [](auto d) { return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(d).count(); };
+    std::cout << "размер | копия: поэлементно / memcpy | InsertAt(0): поэлементно / memmove\n";
+    volatile int sink = 0;
+    for (std::size_t n : {16u, 256u, 4096u, 65536u, 1048576u}) {
+        std::size_t reps = std::max<std::size_t>(1, (std::size_t(1) << 24) / n);
+        DynamicArray<int> src(n);
+        for (std::size_t i = 0; i < n; ++i) src[i] = (int)i;
+
+        // Прежний путь: поэлементное копирование через Get/Set
+        auto t0 = Clock::now();
+        for (std::size_t r = 0; r < reps; ++r) {
+            DynamicArray<int> out(n);
+            for (std::size_t i = 0; i < n; ++i) out.Set(i, src.Get(i));
+            sink = sink + out[n - 1];
+        }
+        double copyOld = ns(Clock::now() - t0) / reps;
+        t0 = Clock::now();
+        for (std::size_t r = 0; r < reps; ++r) {
+            DynamicArray<int> out(src);
+            sink = sink + out[n - 1];
+        }
+        double copyNew = ns(Clock::now() - t0) / reps;
+
+        // Вставка в начало: сдвиг хвоста через Get/Set хранилища vs InsertAt
+        std::size_t inserts = std::max<std::size_t>(1, std::min<std::size_t>(reps, 256));
+        MutableArraySequence<int> oldSeq(src.Data(), n), newSeq(src.Data(), n);
+        t0 = Clock::now();
+        for (std::size_t r = 0; r < inserts; ++r) {
+            auto& st = oldSeq.GetStorage();
+            std::size_t m = st.GetSize();
+            st.Resize(m + 1);
+            for (std::size_t i = m; i > 0; --i) st.Set(i, st.Get(i - 1));
+            st.Set(0, (int)r);
+        }
+        double insOld = ns(Clock::now() - t0) / inserts;
+        t0 = Clock::now();
+        for (std::size_t r = 0; r < inserts; ++r) newSeq.InsertAt((int)r, 0);
+        double insNew = ns(Clock::now() - t0) / inserts;
+        assert(oldSeq.Get(0) == newSeq.Get(0) && oldSeq.GetLast() == newSeq.GetLast());
+
+        std::cout << n << " | " << copyOld << " / " << copyNew << " нс (x" << copyOld / copyNew << ")"
+                  << " | " << insOld << " / " << insNew << " нс (x" << insOld / insNew << ")\n";
+    }
+}